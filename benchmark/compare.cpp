@@ -0,0 +1,120 @@
+#include "exclusive/adaptive_mutex.hpp"
+#include "exclusive/exclusive.hpp"
+#include "exclusive/hybrid_mutex.hpp"
+#include "exclusive/ticket_mutex.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Compares lock throughput by incrementing a shared counter from a varying
+// number of threads, for each `shared_resource` layout.
+//
+// usage: compare [iterations per thread]
+
+namespace {
+
+template <class Layout>
+struct counter {
+    std::size_t value{};
+};
+
+}  // namespace
+
+namespace exclusive {
+
+template <class Layout, class Mutex>
+struct resource_layout<counter<Layout>, Mutex> {
+    using type = Layout;
+};
+
+}  // namespace exclusive
+
+namespace {
+
+constexpr auto max_threads = std::size_t{8};
+
+template <class Mutex, class Layout>
+auto ns_per_access(std::size_t threads, std::size_t iterations) -> double
+{
+    using clock = std::chrono::steady_clock;
+
+    auto resource = exclusive::shared_resource<counter<Layout>, Mutex>{};
+    auto workers = std::vector<std::thread>{};
+
+    const auto start = clock::now();
+
+    for (auto i = std::size_t{}; i != threads; ++i) {
+        workers.emplace_back([&resource, iterations] {
+            for (auto j = std::size_t{}; j != iterations; ++j) {
+                ++(*resource.access()).value;
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    const auto elapsed = std::chrono::duration<double, std::nano>{clock::now() - start};
+
+    if ((*resource.access()).value != threads * iterations) {
+        std::cerr << "lost update\n";
+    }
+
+    return elapsed.count() / static_cast<double>(threads * iterations);
+}
+
+template <class Mutex, class Layout>
+auto report_layout(std::string_view name, std::size_t iterations) -> void
+{
+    std::cout << std::setw(32) << name;
+    for (auto threads = std::size_t{1}; threads <= max_threads; threads *= 2U) {
+        std::cout << std::setw(10) << std::fixed << std::setprecision(1)
+                  << ns_per_access<Mutex, Layout>(threads, iterations);
+    }
+    std::cout << '\n';
+}
+
+template <class Mutex>
+auto report(std::string_view name, std::size_t iterations) -> void
+{
+    const auto label = std::string{name};
+
+    report_layout<Mutex, exclusive::layout::packed>(label + " packed", iterations);
+    report_layout<Mutex, exclusive::layout::isolated>(label + " isolated", iterations);
+    report_layout<Mutex, exclusive::layout::colocated>(label + " colocated", iterations);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const auto iterations = (argc > 1) ? std::stoul(argv[1]) : 10'000UL;
+
+    std::cout << "ns per access, " << iterations << " accesses per thread\n\n";
+
+    std::cout << std::setw(32) << "threads";
+    for (auto threads = std::size_t{1}; threads <= max_threads; threads *= 2U) {
+        std::cout << std::setw(10) << threads;
+    }
+    std::cout << '\n';
+
+    report<std::mutex>("std::mutex", iterations);
+    report<exclusive::adaptive_mutex<max_threads>>("adaptive_mutex", iterations);
+    report<exclusive::array_mutex<max_threads>>("array_mutex", iterations);
+    report<exclusive::clh_mutex<1>>("clh_mutex<1>", iterations);
+    report<exclusive::clh_mutex<2>>("clh_mutex<2>", iterations);
+    report<exclusive::clh_mutex<max_threads>>("clh_mutex", iterations);
+    report<exclusive::clh_mutex<max_threads,
+                                exclusive::failure::retry,
+                                exclusive::pool::local,
+                                exclusive::depth::ticketed>>("clh_mutex ticketed", iterations);
+    report<exclusive::hybrid_mutex<max_threads>>("hybrid_mutex", iterations);
+    report<exclusive::ticket_mutex<>>("ticket_mutex", iterations);
+}
@@ -6,10 +6,84 @@ def _is_clang(repository_ctx, cc):
     return "clang" in repository_ctx.execute([cc, "-v"]).stderr
 
 
+def _positive_int(text):
+    text = text.strip()
+    if text.isdigit() and int(text) > 0:
+        return int(text)
+    return None
+
+
+def _probe(repository_ctx, args):
+    result = repository_ctx.execute(args)
+    if result.return_code != 0:
+        return None
+    return _positive_int(result.stdout)
+
+
+def _cache_geometry(repository_ctx):
+    """Returns the cache line and adjacent-line prefetch pair sizes of the host.
+
+    Either may be overridden with the environment variables
+    `EXCLUSIVE_CACHE_LINE_SIZE` and `EXCLUSIVE_PREFETCH_PAIR_SIZE`, e.g. when
+    cross compiling.
+    """
+    env = repository_ctx.os.environ
+    arch = repository_ctx.execute(["uname", "-m"]).stdout.strip()
+
+    line = _positive_int(env.get("EXCLUSIVE_CACHE_LINE_SIZE", ""))
+    if line == None:
+        if "mac" in repository_ctx.os.name.lower():
+            line = _probe(repository_ctx, ["sysctl", "-n", "hw.cachelinesize"])
+        else:
+            line = (
+                _probe(repository_ctx, [
+                    "cat",
+                    "/sys/devices/system/cpu/cpu0/cache/index0/coherency_line_size",
+                ]) or
+                _probe(repository_ctx, ["getconf", "LEVEL1_DCACHE_LINESIZE"])
+            )
+    if line == None:
+        line = 128 if arch in ["arm64", "aarch64"] else 64
+
+    pair = _positive_int(env.get("EXCLUSIVE_PREFETCH_PAIR_SIZE", ""))
+    if pair == None:
+        # x86 spatial prefetchers fetch cache lines in aligned pairs
+        pair = 2 * line if arch in ["x86_64", "amd64", "i386", "i686"] else line
+
+    return line, pair
+
+
 def _configure_local_variables_impl(repository_ctx):
     """Substitute %{compiler_name} with GCC or CLANG."""
-    # Define an empty BUILD file to allow an external project
-    repository_ctx.file("BUILD", "");
+    line, pair = _cache_geometry(repository_ctx)
+
+    repository_ctx.file(
+        "BUILD",
+        """cc_library(
+    name = "cache_geometry",
+    hdrs = ["include/exclusive/config/cache_geometry.hpp"],
+    strip_include_prefix = "include",
+    visibility = ["//visibility:public"],
+)
+""",
+    )
+
+    repository_ctx.file(
+        "include/exclusive/config/cache_geometry.hpp",
+        """#pragma once
+
+// Generated by configure.bzl from the host cache geometry
+
+#include <cstddef>
+
+namespace exclusive::config {
+
+inline constexpr std::size_t cache_line_size = %d;
+inline constexpr std::size_t prefetch_pair_size = %d;
+
+}  // namespace exclusive::config
+""" % (line, pair),
+    )
 
     cc = repository_ctx.os.environ.get("CC", "CC")
 
@@ -39,13 +113,16 @@ configure_local_variables = repository_rule(
     },
     local = True,
     configure = True,
-    environ = ["CC"],
+    environ = ["CC", "EXCLUSIVE_CACHE_LINE_SIZE", "EXCLUSIVE_PREFETCH_PAIR_SIZE"],
 )
-"""Generates a compiler configuration .bzl file and a Bazel info .bzl file.
+"""Generates a compiler configuration .bzl file, a Bazel info .bzl file, and a
+cache geometry header.
 
-Generate the following .bzl files:
+Generate the following files:
 - `defs.bzl`: sets compiler-dependent variables. From template `defs_template`.
 - `bazel_info.bzl`: sets Bazel info dependent variables.
+- `include/exclusive/config/cache_geometry.hpp`: sets the cache line and
+  prefetch pair sizes of the host, provided by target `cache_geometry`.
 
 Args:
     defs_template: The template file with variable `%{compiler_name}`.
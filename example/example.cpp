@@ -4,6 +4,7 @@
 #include <array>
 #include <chrono>
 #include <cstdint>
+#include <cstdlib>
 #include <functional>
 #include <future>
 #include <iostream>
@@ -13,6 +14,16 @@
 
 namespace {
 
+[[noreturn]] auto fail(const char* what) -> void
+{
+#if defined(__cpp_exceptions)
+    throw std::runtime_error{what};
+#else
+    std::cerr << what << '\n';
+    std::abort();
+#endif
+}
+
 template <class F, std::size_t... Is>
 auto make_array_with_invocable_impl(F&& f, std::index_sequence<Is...>)
 {
@@ -53,7 +64,7 @@ int main()
         while ((i != (TASK_COUNT - 1)) && (N != rsc.queue_count())) {
             // If it's taking too long, give up.
             if (clock::now() > deadline) {
-                throw std::runtime_error{"Try increasing the timeout duration?"};
+                fail("Try increasing the timeout duration?");
             }
         }
     };
@@ -74,12 +85,12 @@ int main()
 
                 count = ++*access_scope;
             } else {
-                throw std::runtime_error{"Try increasing the timeout duration?"};
+                fail("Try increasing the timeout duration?");
             }
 
             if (ENFORCE_FAIRNESS) {
                 if (prev_count && ((count - *prev_count) != N)) {
-                    throw std::runtime_error{"My turn got skipped 😞"};
+                    fail("My turn got skipped 😞");
                 }
                 prev_count = count;
             }
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "mutex.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <type_traits>
+
+/// @brief Provides exclusive access to shared resources
+namespace exclusive {
+
+/// @brief Mutex switching between a spinlock and a queue lock
+///
+/// @tparam N Number of nodes in the queue lock pool. Should match the number
+///     of concurrent threads accessing the lock.
+/// @tparam SpinLimit Number of failed attempts on the lock word before a
+///     thread considers the lock contended
+/// @tparam QuietReleases Number of consecutive releases without queued
+///     waiters before the lock is no longer considered contended
+///
+/// While uncontended, the mutex is a test-and-test-and-set lock on a single
+/// word. If a thread fails to acquire the lock word after `SpinLimit`
+/// attempts, the mutex inflates. Threads then queue on a `clh_mutex` before
+/// contending for the lock word, so that only the head of the queue spins on
+/// it. Once the queue is observed empty on `QuietReleases` consecutive
+/// releases, the mutex deflates.
+///
+/// @note Implements TimedMutex
+template <std::size_t N, std::size_t SpinLimit = 128, std::size_t QuietReleases = 64>
+class adaptive_mutex {
+    static_assert(SpinLimit > 0, "Spin limit must be greater than 0.");
+    static_assert(QuietReleases > 0, "Quiet releases must be greater than 0.");
+
+    // Set while the lock is held
+    alignas(hardware_destructive_interference_size) std::atomic_bool locked_{};
+
+    // Set while threads must queue before acquiring the lock word
+    alignas(hardware_destructive_interference_size) std::atomic_bool inflated_{};
+
+    // Consecutive releases without queued waiters. Only accessed by the lock
+    // holder.
+    std::size_t quiet_releases_{};
+
+    clh_mutex<N> queue_;
+
+    auto try_acquire_word() -> bool
+    {
+        // (A1) acquire the lock word
+        // synchronizes with (A2)
+        return !locked_.load(std::memory_order_relaxed) &&
+               !locked_.exchange(true, std::memory_order_acquire);
+    }
+
+    // Spins on the lock word, then queues once contention is sustained
+    template <class Expired, class Enqueue>
+    auto acquire_contended(Expired expired, Enqueue enqueue) -> bool
+    {
+        if (!inflated_.load(std::memory_order_relaxed)) {
+            for (auto i = std::size_t{}; i != SpinLimit; ++i) {
+                if (try_acquire_word()) {
+                    return true;
+                }
+                if (expired()) {
+                    return false;
+                }
+            }
+
+            // sustained contention
+            inflated_.store(true, std::memory_order_relaxed);
+        }
+
+        if (!enqueue()) {
+            return false;
+        }
+
+        // As the head of the queue, only contend with threads that have not
+        // yet observed inflation.
+        while (!try_acquire_word()) {
+            if (expired()) {
+                queue_.unlock();
+                return false;
+            }
+        }
+
+        queue_.unlock();
+        return true;
+    }
+
+  public:
+    adaptive_mutex()
+    {
+        locked_.store(false, std::memory_order_relaxed);
+        inflated_.store(false, std::memory_order_relaxed);
+    }
+
+    ~adaptive_mutex() = default;
+
+    adaptive_mutex(const adaptive_mutex&) = delete;
+    adaptive_mutex(adaptive_mutex&&) = delete;
+    auto operator=(const adaptive_mutex&) -> adaptive_mutex& = delete;
+    auto operator=(adaptive_mutex&&) -> adaptive_mutex& = delete;
+
+    auto lock() -> void
+    {
+        if (try_acquire_word()) {
+            return;
+        }
+
+        acquire_contended([] { return false; },
+                          [this] {
+                              queue_.lock();
+                              return true;
+                          });
+    }
+
+    auto try_lock() -> bool { return try_acquire_word(); }
+
+    template <class Rep, class Period>
+    auto try_lock_for(const std::chrono::duration<Rep, Period>& duration) -> bool
+    {
+        return try_acquire_word() || try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    template <class Clock, class Duration>
+    auto try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline) -> bool
+    {
+        if (try_acquire_word()) {
+            return true;
+        }
+
+        return acquire_contended([&deadline] { return Clock::now() >= deadline; },
+                                 [this, &deadline] { return queue_.try_lock_until(deadline); });
+    }
+
+    auto unlock()
+    {
+        if (inflated_.load(std::memory_order_relaxed)) {
+            if (queue_.queue_count() != 0U) {
+                quiet_releases_ = 0U;
+            } else if (++quiet_releases_ == QuietReleases) {
+                quiet_releases_ = 0U;
+                inflated_.store(false, std::memory_order_relaxed);
+            }
+        }
+
+        // (A2) release the lock word
+        // synchronizes with (A1)
+        locked_.store(false, std::memory_order_release);
+    }
+
+    /// @brief Checks whether threads queue before acquiring the lock
+    /// NOTE: May be inaccurate due to racing
+    [[nodiscard]] auto inflated() const -> bool
+    {
+        return inflated_.load(std::memory_order_relaxed);
+    }
+};
+
+template <std::size_t N, std::size_t SpinLimit, std::size_t QuietReleases>
+struct is_transferable<adaptive_mutex<N, SpinLimit, QuietReleases>> : std::true_type {};
+
+}  // namespace exclusive
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "interference_size.hpp"
+#include "mutex.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/// @brief Provides exclusive access to shared resources
+namespace exclusive {
+
+/// @brief Queue lock allowing a bounded number of arriving threads to barge
+///
+/// @tparam N Number of nodes in the queue lock pool. Should match the number
+///     of concurrent threads accessing the lock.
+/// @tparam Bypass Maximum number of times arriving threads may acquire the
+///     lock ahead of the thread at the head of the queue
+/// @tparam Window Number of times an arriving thread observes a lock passed to
+///     the head of the queue before considering the head descheduled
+///
+/// Threads queue on a `clh_mutex` before acquiring a lock word, so that only
+/// the head of the queue spins on it. On unlock, if threads are queued, the
+/// lock word is passed to the head of the queue. An arriving thread may
+/// barge ahead of the queue if the lock word is free, or if the head has not
+/// claimed a passed lock within `Window` observations, as long as fewer than
+/// `Bypass` threads have barged ahead of the current head. Otherwise the
+/// arriving thread queues.
+///
+/// With a `Bypass` of 0, locks are granted in FIFO order.
+///
+/// @note Implements TimedMutex
+template <std::size_t N, std::size_t Bypass = 8, std::size_t Window = 64>
+class barging_mutex {
+    static_assert(Window > 0, "Window must be greater than 0.");
+
+    static constexpr std::uint8_t unlocked = 0U;
+    static constexpr std::uint8_t locked = 1U;
+    static constexpr std::uint8_t passed = 2U;
+
+    // Lock word state
+    alignas(hardware_destructive_interference_size) std::atomic<std::uint8_t> state_{};
+
+    // Number of threads that have barged ahead of the head of the queue.
+    // Only written by the lock holder.
+    std::atomic<std::size_t> bypassed_{};
+
+    clh_mutex<N> queue_;
+
+    auto try_acquire_word(std::uint8_t s) -> bool
+    {
+        // (B1) acquire the lock word
+        // synchronizes with (B2)
+        return (state_.load(std::memory_order_relaxed) == s) &&
+               state_.compare_exchange_strong(
+                   s, locked, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    auto try_claim() -> bool { return try_acquire_word(passed) || try_acquire_word(unlocked); }
+
+    auto try_barge() -> bool
+    {
+        if (queue_.queue_count() == 0U) {
+            return try_claim();
+        }
+
+        if (bypassed_.load(std::memory_order_relaxed) >= Bypass) {
+            return false;
+        }
+
+        if (!try_acquire_word(unlocked)) {
+            // A passed lock is only taken from a head that appears descheduled
+            for (auto i = std::size_t{}; i != Window; ++i) {
+                if (state_.load(std::memory_order_relaxed) != passed) {
+                    return false;
+                }
+            }
+
+            if (!try_acquire_word(passed)) {
+                return false;
+            }
+        }
+
+        bypassed_.store(bypassed_.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Called by the head of the queue after claiming the lock word
+    auto leave_queue() -> void
+    {
+        bypassed_.store(0U, std::memory_order_relaxed);
+        queue_.unlock();
+    }
+
+  public:
+    barging_mutex()
+    {
+        state_.store(unlocked, std::memory_order_relaxed);
+        bypassed_.store(0U, std::memory_order_relaxed);
+    }
+
+    ~barging_mutex() = default;
+
+    barging_mutex(const barging_mutex&) = delete;
+    barging_mutex(barging_mutex&&) = delete;
+    auto operator=(const barging_mutex&) -> barging_mutex& = delete;
+    auto operator=(barging_mutex&&) -> barging_mutex& = delete;
+
+    auto lock() -> void
+    {
+        if (try_barge()) {
+            return;
+        }
+
+        queue_.lock();
+        while (!try_claim()) {}
+        leave_queue();
+    }
+
+    auto try_lock() -> bool { return try_barge(); }
+
+    template <class Rep, class Period>
+    auto try_lock_for(const std::chrono::duration<Rep, Period>& duration) -> bool
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    template <class Clock, class Duration>
+    auto try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline) -> bool
+    {
+        if (try_barge()) {
+            return true;
+        }
+
+        if (!queue_.try_lock_until(deadline)) {
+            return false;
+        }
+
+        while (!try_claim()) {
+            if (Clock::now() >= deadline) {
+                queue_.unlock();
+                return false;
+            }
+        }
+
+        leave_queue();
+        return true;
+    }
+
+    auto unlock() -> void
+    {
+        // (B2) release the lock word, passing it to the head of the queue if
+        // there is one
+        // synchronizes with (B1)
+        state_.store((queue_.queue_count() != 0U) ? passed : unlocked, std::memory_order_release);
+    }
+
+    /// @brief Number of threads that have barged ahead of the head of the
+    ///     queue
+    /// NOTE: May be inaccurate due to racing
+    [[nodiscard]] auto bypassed() const -> std::size_t
+    {
+        return bypassed_.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Current number of threads waiting on the queue
+    /// NOTE: May be inaccurate due to racing
+    [[nodiscard]] auto queue_count() const -> unsigned int { return queue_.queue_count(); }
+};
+
+template <std::size_t N, std::size_t Bypass, std::size_t Window>
+struct is_transferable<barging_mutex<N, Bypass, Window>> : std::true_type {};
+
+}  // namespace exclusive
@@ -0,0 +1,263 @@
+#pragma once
+
+#include "interference_size.hpp"
+#include "mutex.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+/// @brief Provides exclusive access to shared resources
+namespace exclusive {
+
+/// Policies for determining the NUMA node of the calling thread
+namespace topology {
+
+/// All threads are treated as running on the same NUMA node
+struct uniform {
+    static auto current_node() -> unsigned { return 0U; }
+};
+
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 29)))
+/// NUMA node of the CPU the calling thread is running on, using `getcpu`
+struct getcpu {
+    static auto current_node() -> unsigned
+    {
+        auto cpu = 0U;
+        auto node = 0U;
+        return (::getcpu(&cpu, &node) == 0) ? node : 0U;
+    }
+};
+
+using native = getcpu;
+#else
+using native = uniform;
+#endif
+
+}  // namespace topology
+
+namespace detail {
+
+struct alignas(hardware_prefetch_interference_size) cna_node {
+    std::atomic<cna_node*> next{};
+
+    /// Set when the lock is granted. Either `granted`, or the head of the
+    /// secondary queue.
+    std::atomic<std::uintptr_t> spin{};
+
+    /// NUMA node of the owning thread
+    unsigned numa_node{};
+
+    /// Tail of the secondary queue. Only valid for the head of the secondary
+    /// queue.
+    cna_node* secondary_tail{};
+};
+
+}  // namespace detail
+
+/// @brief Mutex implementing a Compact NUMA-Aware (CNA) queue lock
+///
+/// @tparam Topology Policy determining the NUMA node of the calling thread
+/// @tparam Window Maximum number of consecutive handoffs within a NUMA node
+///     while threads on other nodes are waiting
+///
+/// An MCS queue lock where the lock holder passes the lock to a waiter on the
+/// same NUMA node, if there is one. Waiters on other nodes that are skipped
+/// over are moved to a secondary queue, which is spliced back into the main
+/// queue after `Window` consecutive handoffs within a node, or once the main
+/// queue is empty. The lock state is a single tail pointer.
+///
+/// Queue nodes are owned by threads and created on first use.
+///
+/// Similar to the CNA lock described by Dice and Kogan.
+///
+/// @note Implements Lockable. A lock must be unlocked by the thread that
+///     locked it, as the lock is passed to a waiter on the NUMA node of the
+///     unlocking thread.
+template <class Topology = topology::native, std::size_t Window = 256>
+class cna_mutex {
+    static_assert(Window > 0, "Window must be greater than 0.");
+
+    using node = detail::cna_node;
+    using nodes = detail::thread_nodes<node>;
+
+    static constexpr auto waiting = std::uintptr_t{0};
+    static constexpr auto granted = std::uintptr_t{1};
+
+    std::atomic<node*> tail_{};
+
+    // Node granted exclusive access
+    node* active_{};
+
+    // Consecutive handoffs within a NUMA node. Only accessed by the lock
+    // holder.
+    std::size_t local_handoffs_{};
+
+    static auto secondary_head(std::uintptr_t spin) -> node*
+    {
+        return reinterpret_cast<node*>(spin);
+    }
+
+    static auto grant(node* n, std::uintptr_t spin) -> void
+    {
+        // (N1) grant the lock
+        // synchronizes with (N2)
+        n->spin.store(spin, std::memory_order_release);
+    }
+
+    /// Finds a waiter on the same NUMA node as `me`, moving waiters before it
+    /// to the secondary queue
+    static auto find_successor(node* me) -> node*
+    {
+        auto* next = me->next.load(std::memory_order_relaxed);
+        if (next->numa_node == me->numa_node) {
+            return next;
+        }
+
+        auto* skipped_head = next;
+        auto* skipped_tail = next;
+
+        for (auto* n = next->next.load(std::memory_order_acquire); n != nullptr;
+             n = n->next.load(std::memory_order_acquire)) {
+            if (n->numa_node == me->numa_node) {
+                const auto spin = me->spin.load(std::memory_order_relaxed);
+
+                if (spin == granted) {
+                    me->spin.store(reinterpret_cast<std::uintptr_t>(skipped_head),
+                                   std::memory_order_relaxed);
+                } else {
+                    secondary_head(spin)->secondary_tail->next.store(skipped_head,
+                                                                     std::memory_order_relaxed);
+                    skipped_head = secondary_head(spin);
+                }
+
+                skipped_head->secondary_tail = skipped_tail;
+                skipped_tail->next.store(nullptr, std::memory_order_relaxed);
+
+                me->next.store(n, std::memory_order_relaxed);
+                return n;
+            }
+
+            skipped_tail = n;
+        }
+
+        return nullptr;
+    }
+
+  public:
+    cna_mutex() { tail_.store(nullptr, std::memory_order_relaxed); }
+
+    ~cna_mutex() = default;
+
+    cna_mutex(const cna_mutex&) = delete;
+    cna_mutex(cna_mutex&&) = delete;
+    auto operator=(const cna_mutex&) -> cna_mutex& = delete;
+    auto operator=(cna_mutex&&) -> cna_mutex& = delete;
+
+    auto lock() -> void
+    {
+        auto* me = nodes::try_pop();
+        me->next.store(nullptr, std::memory_order_relaxed);
+        me->spin.store(waiting, std::memory_order_relaxed);
+
+        // (N3) swap predecessor with self
+        // synchronizes with (N3), (N4)
+        auto* pred = tail_.exchange(me, std::memory_order_acq_rel);
+
+        if (pred == nullptr) {
+            me->spin.store(granted, std::memory_order_relaxed);
+        } else {
+            // published to the lock holder with `next`
+            me->numa_node = Topology::current_node();
+
+            // (N5) link behind predecessor
+            // synchronizes with (N6)
+            pred->next.store(me, std::memory_order_release);
+
+            // (N2) wait for the lock to be granted
+            // synchronizes with (N1)
+            while (me->spin.load(std::memory_order_acquire) == waiting) {}
+        }
+
+        active_ = me;
+    }
+
+    auto try_lock() -> bool
+    {
+        auto* me = nodes::try_pop();
+        me->next.store(nullptr, std::memory_order_relaxed);
+        me->spin.store(granted, std::memory_order_relaxed);
+
+        auto* expected = static_cast<node*>(nullptr);
+
+        // (N3) swap predecessor with self
+        // synchronizes with (N3), (N4)
+        if (!tail_.compare_exchange_strong(
+                expected, me, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            nodes::push(me);
+            return false;
+        }
+
+        active_ = me;
+        return true;
+    }
+
+    auto unlock() -> void
+    {
+        auto* me = active_;
+        me->numa_node = Topology::current_node();
+
+        // (N6) check for a successor
+        // synchronizes with (N5)
+        auto* next = me->next.load(std::memory_order_acquire);
+
+        if (next == nullptr) {
+            const auto spin = me->spin.load(std::memory_order_relaxed);
+
+            // Without a successor, the secondary queue (if any) becomes the
+            // main queue
+            auto* new_tail = (spin == granted) ? nullptr : secondary_head(spin)->secondary_tail;
+            auto* expected = me;
+
+            // (N4) release the lock
+            // synchronizes with (N3)
+            if (tail_.compare_exchange_strong(
+                    expected, new_tail, std::memory_order_release, std::memory_order_relaxed)) {
+                if (spin != granted) {
+                    local_handoffs_ = 0U;
+                    grant(secondary_head(spin), granted);
+                }
+                nodes::push(me);
+                return;
+            }
+
+            // wait for the successor to link behind this node
+            while ((next = me->next.load(std::memory_order_acquire)) == nullptr) {}
+        }
+
+        auto* succ = (local_handoffs_ != Window) ? find_successor(me) : nullptr;
+        const auto spin = me->spin.load(std::memory_order_relaxed);
+
+        if (succ != nullptr) {
+            ++local_handoffs_;
+            grant(succ, spin);
+        } else if (spin != granted) {
+            // splice the secondary queue ahead of the main queue
+            local_handoffs_ = 0U;
+            secondary_head(spin)->secondary_tail->next.store(
+                me->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            grant(secondary_head(spin), granted);
+        } else {
+            local_handoffs_ = 0U;
+            grant(next, granted);
+        }
+
+        nodes::push(me);
+    }
+};
+
+}  // namespace exclusive
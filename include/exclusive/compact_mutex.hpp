@@ -0,0 +1,169 @@
+#pragma once
+
+#include "mutex.hpp"
+#include "parking_lot.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+
+/// @brief Provides exclusive access to shared resources
+namespace exclusive {
+
+/// @brief Mutex occupying a single byte
+///
+/// Threads that fail to acquire the lock after spinning briefly park in the
+/// process-wide `parking_lot`, keyed by the address of the mutex. On unlock,
+/// ownership is handed directly to the thread that has been parked the
+/// longest, so parked threads are granted the lock in FIFO order.
+///
+/// Intended for embedding a lock in every one of a large number of objects.
+///
+/// @note Implements TimedMutex
+class compact_mutex {
+    static constexpr std::uint8_t locked_bit = 1U;
+    static constexpr std::uint8_t parked_bit = 2U;
+
+    // Number of times to yield before parking
+    static constexpr auto spin_limit = 40;
+
+    std::atomic<std::uint8_t> state_{};
+
+    template <class Park, class Expired>
+    auto lock_slow(Park park, Expired expired) -> bool
+    {
+        auto spins = 0;
+
+        for (;;) {
+            auto s = state_.load(std::memory_order_relaxed);
+
+            if ((s & locked_bit) == 0U) {
+                // (P1) acquire the lock
+                // synchronizes with (P2)
+                if (state_.compare_exchange_weak(s,
+                                                 static_cast<std::uint8_t>(s | locked_bit),
+                                                 std::memory_order_acquire,
+                                                 std::memory_order_relaxed)) {
+                    return true;
+                }
+                continue;
+            }
+
+            if (expired()) {
+                return false;
+            }
+
+            if ((s & parked_bit) == 0U) {
+                if (spins != spin_limit) {
+                    ++spins;
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                if (!state_.compare_exchange_weak(s,
+                                                  static_cast<std::uint8_t>(s | parked_bit),
+                                                  std::memory_order_relaxed,
+                                                  std::memory_order_relaxed)) {
+                    continue;
+                }
+            }
+
+            switch (park()) {
+                case parking_lot::park_result::unparked:
+                    // ownership has been handed off
+                    return true;
+                case parking_lot::park_result::timeout:
+                    return false;
+                case parking_lot::park_result::invalid:
+                    break;
+            }
+        }
+    }
+
+    [[nodiscard]] auto should_park() const -> bool
+    {
+        return state_.load(std::memory_order_relaxed) == (locked_bit | parked_bit);
+    }
+
+  public:
+    compact_mutex() { state_.store(0U, std::memory_order_relaxed); }
+
+    ~compact_mutex() = default;
+
+    compact_mutex(const compact_mutex&) = delete;
+    compact_mutex(compact_mutex&&) = delete;
+    auto operator=(const compact_mutex&) -> compact_mutex& = delete;
+    auto operator=(compact_mutex&&) -> compact_mutex& = delete;
+
+    auto lock() -> void
+    {
+        if (try_lock()) {
+            return;
+        }
+
+        lock_slow([this] { return parking_lot::park(this, [this] { return should_park(); }); },
+                  [] { return false; });
+    }
+
+    auto try_lock() -> bool
+    {
+        auto s = std::uint8_t{};
+
+        // (P1) acquire the lock
+        // synchronizes with (P2)
+        return state_.compare_exchange_strong(
+            s, locked_bit, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    template <class Rep, class Period>
+    auto try_lock_for(const std::chrono::duration<Rep, Period>& duration) -> bool
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    template <class Clock, class Duration>
+    auto try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline) -> bool
+    {
+        if (try_lock()) {
+            return true;
+        }
+
+        return lock_slow(
+            [this, &deadline] {
+                return parking_lot::park_until(
+                    this, [this] { return should_park(); }, deadline);
+            },
+            [&deadline] { return Clock::now() >= deadline; });
+    }
+
+    auto unlock() -> void
+    {
+        auto s = locked_bit;
+
+        // (P2) release the lock
+        // synchronizes with (P1)
+        if (state_.compare_exchange_strong(
+                s, std::uint8_t{}, std::memory_order_release, std::memory_order_relaxed)) {
+            return;
+        }
+
+        parking_lot::unpark_one(this, [this](auto result) {
+            if (result.unparked) {
+                // hand off ownership, leaving the lock bit set
+                state_.store(result.may_have_more ? (locked_bit | parked_bit) : locked_bit,
+                             std::memory_order_relaxed);
+            } else {
+                // (P2) release the lock
+                // synchronizes with (P1)
+                state_.store(0U, std::memory_order_release);
+            }
+        });
+    }
+};
+
+template <>
+struct is_transferable<compact_mutex> : std::true_type {};
+
+}  // namespace exclusive
@@ -2,10 +2,19 @@
 
 #include "mutex.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <cstddef>
+#include <functional>
 #include <mutex>
+#include <numeric>
+#include <system_error>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 /// @brief Provides exclusive access to shared resources
 namespace exclusive {
@@ -13,6 +22,70 @@ namespace exclusive {
 template <class T, class Mutex>
 class shared_resource;
 
+template <class... Resources>
+class scoped_access_all;
+
+template <class T, class Mutex>
+class scoped_access_any;
+
+template <class T, class Mutex>
+class transferable_access;
+
+template <class T, class Mutex>
+class leased_access;
+
+namespace detail {
+
+/// @brief Determines a global acquisition order for a set of locks
+/// @param locks Tuple of `std::unique_lock`s, each associated with a distinct mutex
+/// @return Indices into `locks`, sorted by mutex address
+template <class... Locks>
+auto lock_order(const std::tuple<Locks...>& locks) -> std::array<std::size_t, sizeof...(Locks)>
+{
+    constexpr auto size = sizeof...(Locks);
+
+    const auto addresses = std::apply(
+        [](const auto&... lk) { return std::array<const void*, size>{lk.mutex()...}; }, locks);
+
+    auto order = std::array<std::size_t, size>{};
+    std::iota(order.begin(), order.end(), std::size_t{});
+    std::sort(order.begin(), order.end(), [&addresses](auto i, auto j) {
+        return std::less<>{}(addresses[i], addresses[j]);
+    });
+
+    // the same mutex can't be locked twice
+    assert(std::adjacent_find(order.begin(), order.end(), [&addresses](auto i, auto j) {
+               return addresses[i] == addresses[j];
+           }) == order.end());
+
+    return order;
+}
+
+template <class Tuple, class F, std::size_t... Is>
+auto visit_at(Tuple& t, std::size_t i, F& f, std::index_sequence<Is...>) -> bool
+{
+    auto result = false;
+    ((Is == i ? void(result = f(std::get<Is>(t))) : void()), ...);
+    return result;
+}
+
+/// @brief Invokes a predicate with the i-th element of a tuple
+/// @return Result of the predicate, or `false` if `i` is out of range
+template <class Tuple, class F>
+auto visit_at(Tuple& t, std::size_t i, F f) -> bool
+{
+    return visit_at(t, i, f, std::make_index_sequence<std::tuple_size_v<Tuple>>{});
+}
+
+/// @brief Unlocks each owned lock in a tuple of `std::unique_lock`s
+template <class... Locks>
+auto unlock_all(std::tuple<Locks...>& locks) -> void
+{
+    std::apply([](auto&... lk) { ((lk.owns_lock() ? lk.unlock() : void()), ...); }, locks);
+}
+
+}  // namespace detail
+
 /// @brief Scoped access token for a shared resource
 /// @tparam T Resource type
 /// @tparam Mutex Mutex type
@@ -28,6 +101,7 @@ class scoped_access {
     T* resource_;
 
     friend class shared_resource<T, Mutex>;
+    friend class leased_access<T, Mutex>;
 
     template <class... LockArgs>
     scoped_access(T& r, Mutex& m, LockArgs&&... lock_args)
@@ -49,6 +123,92 @@ class scoped_access {
     /// @}
 
 
+    /// @brief Access the shared resource
+    /// @pre `owns_lock()` returns `true`
+    ///
+    /// Users are expected *not* to store the underlying reference.
+    [[nodiscard]] auto operator*() const -> T&
+    {
+        assert(*this);
+        return *resource_;
+    }
+
+    /// @brief Hands off access if other threads are waiting on the resource
+    /// @return `true` if access was handed off and then reacquired
+    /// @pre `owns_lock()` returns `true`
+    ///
+    /// Allows long running work to hold access over many iterations without
+    /// starving other threads. If the mutex is contended, it is released and
+    /// then locked again, queuing after the current waiters.
+    ///
+    /// References to the resource may be modified by other threads during
+    /// the call and must be reloaded afterwards.
+    template <class M = Mutex>
+    auto yield_if_contended() -> decltype(std::declval<const M&>().contended())
+    {
+        assert(*this);
+
+        if (!lock_.mutex()->contended()) {
+            return false;
+        }
+
+        lock_.unlock();
+        lock_.lock();
+        return true;
+    }
+};
+
+/// @brief Movable access token for a shared resource
+/// @tparam T Resource type
+/// @tparam Mutex Mutex type, which must be transferable
+///
+/// Similar to `scoped_access` but ownership of the lock may be moved, including
+/// to another thread. This allows access to be passed along the stages of a
+/// pipeline without releasing and reacquiring the mutex. On destruction,
+/// releases the mutex if it is owned.
+///
+/// Moving a token to another thread must be synchronized (e.g. by a queue or
+/// a `std::promise`) so that the receiving thread observes prior
+/// modifications to the resource.
+///
+/// This type is only intended to be created by a `shared_resource<T>`.
+template <class T, class Mutex>
+class transferable_access {
+    static_assert(is_transferable_v<Mutex>);
+
+    std::unique_lock<Mutex> lock_;
+    T* resource_;
+
+    friend class shared_resource<T, Mutex>;
+
+    template <class... LockArgs>
+    transferable_access(T& r, Mutex& m, LockArgs&&... lock_args)
+        : lock_{m, std::forward<LockArgs>(lock_args)...}, resource_{lock_ ? &r : nullptr}
+    {}
+
+  public:
+    ~transferable_access() = default;
+
+    transferable_access(const transferable_access&) = delete;
+    auto operator=(const transferable_access&) -> transferable_access& = delete;
+
+    transferable_access(transferable_access&& other) noexcept
+        : lock_{std::move(other.lock_)}, resource_{std::exchange(other.resource_, nullptr)}
+    {}
+
+    auto operator=(transferable_access&& other) noexcept -> transferable_access&
+    {
+        lock_ = std::move(other.lock_);
+        resource_ = std::exchange(other.resource_, nullptr);
+        return *this;
+    }
+
+    /// @{
+    /// @brief Checks whether `*this` owns access
+    [[nodiscard]] auto owns_lock() const noexcept -> bool { return lock_.owns_lock(); }
+    [[nodiscard]] explicit operator bool() const noexcept { return owns_lock(); }
+    /// @}
+
     /// @brief Access the shared resource
     /// @pre `owns_lock()` returns `true`
     ///
@@ -60,16 +220,407 @@ class scoped_access {
     }
 };
 
+/// @brief Describes an access lease that exceeded its hold budget
+struct lease_overrun {
+    /// Time access was acquired
+    std::chrono::steady_clock::time_point acquired;
+
+    /// Requested hold budget
+    std::chrono::steady_clock::duration budget;
+
+    /// Duration access had been held when the overrun was detected
+    std::chrono::steady_clock::duration held;
+
+    /// Label of the holder, if provided when acquiring access
+    const char* holder;
+};
+
+/// @brief Callback for access leases that exceed their hold budget
+///
+/// Called either by a thread waiting on the resource or by the holder when
+/// releasing access, and at most once per lease.
+using overrun_handler = void (*)(const lease_overrun&);
+
+namespace detail {
+
+/// @brief Checks whether a mutex allows a thread to wait on the lock without
+/// blocking (e.g. `clh_mutex`)
+template <class Mutex, class = void>
+struct has_waiter : std::false_type {};
+
+template <class Mutex>
+struct has_waiter<Mutex, std::void_t<typename Mutex::waiter>> : std::true_type {};
+
+template <class Mutex>
+inline constexpr bool has_waiter_v = has_waiter<Mutex>::value;
+
+/// @brief Tracks the hold budget of the current holder of a shared resource
+class lease_monitor {
+    using clock = std::chrono::steady_clock;
+
+    // Expiry of the current lease, as a count since the clock epoch. Zero if
+    // there is no lease or if an overrun has already been reported.
+    std::atomic<clock::rep> expiry_{};
+    std::atomic<clock::rep> acquired_{};
+    std::atomic<const char*> holder_{};
+
+    std::atomic<overrun_handler> handler_{};
+    std::atomic_uint overrun_count_{};
+
+    auto report(clock::rep acquired, clock::rep expiry, const char* holder, clock::time_point now)
+        -> void
+    {
+        overrun_count_.fetch_add(1U, std::memory_order_relaxed);
+
+        if (auto* handler = handler_.load(std::memory_order_acquire)) {
+            const auto start = clock::time_point{clock::duration{acquired}};
+            handler(lease_overrun{
+                start, clock::duration{expiry - acquired}, now - start, holder});
+        }
+    }
+
+  public:
+    lease_monitor()
+    {
+        expiry_.store(0, std::memory_order_relaxed);
+        acquired_.store(0, std::memory_order_relaxed);
+        holder_.store(nullptr, std::memory_order_relaxed);
+        handler_.store(nullptr, std::memory_order_relaxed);
+        overrun_count_.store(0U, std::memory_order_relaxed);
+    }
+
+    /// @pre Called by the holder, after acquiring access
+    auto begin(clock::time_point acquired, clock::duration budget, const char* holder) -> void
+    {
+        acquired_.store(acquired.time_since_epoch().count(), std::memory_order_relaxed);
+        holder_.store(holder, std::memory_order_relaxed);
+
+        // (L1) publish lease
+        // synchronizes with (L3)
+        expiry_.store((acquired + budget).time_since_epoch().count(), std::memory_order_release);
+    }
+
+    /// @pre Called by the holder, before releasing access
+    auto end(clock::time_point now) -> void
+    {
+        // (L2) retire lease
+        // synchronizes with (L4)
+        const auto expiry = expiry_.exchange(0, std::memory_order_acq_rel);
+
+        if ((expiry != 0) && (now.time_since_epoch().count() > expiry)) {
+            report(acquired_.load(std::memory_order_relaxed),
+                   expiry,
+                   holder_.load(std::memory_order_relaxed),
+                   now);
+        }
+    }
+
+    /// @brief Check if the current holder has exceeded its hold budget
+    ///
+    /// Called by waiting threads. Only a relaxed load if there is no lease.
+    auto check(clock::time_point now) -> void
+    {
+        if (expiry_.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+
+        // (L3) load lease
+        // synchronizes with (L1)
+        auto expiry = expiry_.load(std::memory_order_acquire);
+        if ((expiry == 0) || (now.time_since_epoch().count() <= expiry)) {
+            return;
+        }
+
+        // load lease details before claiming the report, as they may be
+        // overwritten by the next holder afterwards
+        const auto acquired = acquired_.load(std::memory_order_relaxed);
+        const auto* holder = holder_.load(std::memory_order_relaxed);
+
+        // (L4) claim the report
+        // synchronizes with (L2)
+        if (expiry_.compare_exchange_strong(
+                expiry, 0, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            report(acquired, expiry, holder, now);
+        }
+    }
+
+    auto set_handler(overrun_handler handler) -> void
+    {
+        handler_.store(handler, std::memory_order_release);
+    }
+
+    [[nodiscard]] auto overrun_count() const -> unsigned int
+    {
+        return overrun_count_.load(std::memory_order_relaxed);
+    }
+};
+
+}  // namespace detail
+
+/// @brief Scoped access token with a hold budget
+/// @tparam T Resource type
+/// @tparam Mutex Mutex type
+///
+/// Similar to `scoped_access` but records the time access is acquired. If
+/// access is held longer than the hold budget, the overrun is reported by
+/// the shared resource.
+///
+/// This type is only intended to be created by a `shared_resource<T>`.
+template <class T, class Mutex>
+class leased_access {
+    scoped_access<T, Mutex> access_;
+    detail::lease_monitor* monitor_;
+    std::chrono::steady_clock::time_point acquired_;
+
+    friend class shared_resource<T, Mutex>;
+
+    template <class... LockArgs>
+    leased_access(detail::lease_monitor& monitor,
+                  std::chrono::steady_clock::duration budget,
+                  const char* holder,
+                  T& r,
+                  Mutex& m,
+                  LockArgs&&... lock_args)
+        : access_{r, m, std::forward<LockArgs>(lock_args)...},
+          monitor_{&monitor},
+          acquired_{std::chrono::steady_clock::now()}
+    {
+        if (access_) {
+            monitor_->begin(acquired_, budget, holder);
+        }
+    }
+
+  public:
+    ~leased_access()
+    {
+        if (access_) {
+            monitor_->end(std::chrono::steady_clock::now());
+        }
+    }
+
+    leased_access(const leased_access&) = delete;
+    leased_access(leased_access&&) = delete;
+    auto operator=(const leased_access&) -> leased_access& = delete;
+    auto operator=(leased_access&&) -> leased_access& = delete;
+
+    /// @{
+    /// @brief Checks whether `*this` acquired access
+    [[nodiscard]] auto owns_lock() const noexcept -> bool { return access_.owns_lock(); }
+    [[nodiscard]] explicit operator bool() const noexcept { return owns_lock(); }
+    /// @}
+
+    /// @brief Time access was acquired
+    /// @pre `owns_lock()` returns `true`
+    [[nodiscard]] auto acquired_at() const -> std::chrono::steady_clock::time_point
+    {
+        assert(*this);
+        return acquired_;
+    }
+
+    /// @brief Access the shared resource
+    /// @pre `owns_lock()` returns `true`
+    ///
+    /// Users are expected *not* to store the underlying reference.
+    [[nodiscard]] auto operator*() const -> T& { return *access_; }
+};
+
+/// Memory layouts of the resource and mutex of a `shared_resource`
+namespace layout {
+
+/// The resource is declared next to the mutex, without padding
+struct packed {};
+
+/// The resource and mutex are placed on separate cache lines, so that
+/// waiters spinning on the mutex do not contend with the lock holder
+/// accessing the resource
+struct isolated {};
+
+/// The mutex is placed at the start of a cache line, followed by the
+/// resource, so that acquiring the lock brings the resource into the cache of
+/// the new holder. Only effective if the mutex is not over-aligned and both fit in a
+/// cache line.
+struct colocated {};
+
+}  // namespace layout
+
+/// @brief Memory layout of a `shared_resource<T, Mutex>`
+///
+/// Specialize to select a layout for a resource or mutex type.
+template <class T, class Mutex>
+struct resource_layout {
+    using type = layout::packed;
+};
+
+template <class T, class Mutex>
+using resource_layout_t = typename resource_layout<T, Mutex>::type;
+
+namespace detail {
+
+template <class T, class Mutex, class Layout>
+struct resource_storage;
+
+template <class T, class Mutex>
+struct resource_storage<T, Mutex, layout::packed> {
+    T resource_{};
+    Mutex mutex_{};
+};
+
+template <class T, class Mutex>
+struct resource_storage<T, Mutex, layout::isolated> {
+    alignas(hardware_prefetch_interference_size) T resource_{};
+    alignas(hardware_prefetch_interference_size) Mutex mutex_{};
+};
+
+template <class T, class Mutex>
+struct alignas(hardware_destructive_interference_size)
+    resource_storage<T, Mutex, layout::colocated> {
+    Mutex mutex_{};
+    T resource_{};
+};
+
+}  // namespace detail
+
+/// Lease support of a `shared_resource`
+namespace lease {
+
+/// Access cannot be acquired with a hold budget. No lease state is stored.
+struct none {};
+
+/// Access can be acquired with a hold budget, with overruns reported by the
+/// holder or by waiting threads
+///
+/// Threads waiting in `access`, `access_all` or `access_any` check the lease if
+/// the mutex allows waiting without blocking (e.g. `clh_mutex`). Otherwise,
+/// overruns are only reported by the holder.
+struct monitored {};
+
+}  // namespace lease
+
+/// @brief Lease support of a `shared_resource<T, Mutex>`
+///
+/// Specialize to enable leases for a resource or mutex type.
+template <class T, class Mutex>
+struct resource_lease {
+    using type = lease::none;
+};
+
+template <class T, class Mutex>
+using resource_lease_t = typename resource_lease<T, Mutex>::type;
+
+namespace detail {
+
+template <class Lease>
+struct lease_storage;
+
+template <>
+struct lease_storage<lease::none> {};
+
+template <>
+struct lease_storage<lease::monitored> {
+    lease_monitor lease_monitor_{};
+};
+
+}  // namespace detail
+
 /// @brief A shared resource with synchronized access
 /// @tparam T Resource type
 /// @tparam Mutex Mutex type (except `try_lock()` isn't necessary)
+///
+/// The placement of the resource relative to the mutex is determined by
+/// `resource_layout<T, Mutex>`. Access with a hold budget is only available if
+/// enabled by `resource_lease<T, Mutex>`, so that other resources do not store
+/// lease state.
 template <class T, class Mutex = std::timed_mutex>
-class shared_resource {
+class shared_resource : detail::resource_storage<T, Mutex, resource_layout_t<T, Mutex>>,
+                        detail::lease_storage<resource_lease_t<T, Mutex>> {
     static_assert(std::is_object_v<T>);
     static_assert(std::is_default_constructible_v<T>);
 
-    T resource_{};
-    Mutex mutex_{};
+    using base = detail::resource_storage<T, Mutex, resource_layout_t<T, Mutex>>;
+    using base::mutex_;
+    using base::resource_;
+
+    static constexpr auto is_leased =
+        std::is_same_v<lease::monitored, resource_lease_t<T, Mutex>>;
+
+    template <class...>
+    friend class scoped_access_all;
+
+    friend class scoped_access_any<T, Mutex>;
+
+    // Reports an overrun of the current holder's lease, if any
+    auto check_lease([[maybe_unused]] const std::chrono::steady_clock::time_point& now) -> void
+    {
+        if constexpr (is_leased) {
+            this->lease_monitor_.check(now);
+        }
+    }
+
+    // Waits for the lock in this thread, allowing the lease of the current
+    // holder to be checked while waiting
+    auto lock_until(const std::chrono::steady_clock::time_point& deadline) -> bool
+    {
+        auto ec = std::error_code{};
+        const auto locked = lock_until(deadline, ec);
+        if (ec) {
+            detail::raise(ec);
+        }
+        return locked;
+    }
+
+    auto lock_until(const std::chrono::steady_clock::time_point& deadline, std::error_code& ec)
+        -> bool
+    {
+        auto w = mutex_.enqueue_until(deadline, ec);
+        if (!w) {
+            return false;
+        }
+
+        while (!mutex_.poll(w)) {
+            const auto now = std::chrono::steady_clock::now();
+            check_lease(now);
+
+            if (now >= deadline) {
+                mutex_.abandon(w);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <class Token, class... Args>
+    auto acquire_until(const std::chrono::steady_clock::time_point& deadline, Args&&... args)
+        -> Token
+    {
+        if (lock_until(deadline)) {
+            return Token{std::forward<Args>(args)..., resource_, mutex_, std::adopt_lock};
+        }
+        return Token{std::forward<Args>(args)..., resource_, mutex_, std::defer_lock};
+    }
+
+    template <class Token, class... Args>
+    auto acquire(Args&&... args) -> Token
+    {
+        if constexpr (detail::has_waiter_v<Mutex>) {
+            return acquire_until<Token>(std::chrono::steady_clock::time_point::max(),
+                                        std::forward<Args>(args)...);
+        } else {
+            return Token{std::forward<Args>(args)..., resource_, mutex_};
+        }
+    }
+
+    template <class Token, class Rep, class Period, class... Args>
+    auto acquire_within(const std::chrono::duration<Rep, Period>& duration, Args&&... args)
+        -> Token
+    {
+        if constexpr (detail::has_waiter_v<Mutex>) {
+            return acquire_until<Token>(std::chrono::steady_clock::now() + duration,
+                                        std::forward<Args>(args)...);
+        } else {
+            return Token{std::forward<Args>(args)..., resource_, mutex_, duration};
+        }
+    }
 
   public:
     using resource_type = T;
@@ -86,7 +637,10 @@ class shared_resource {
 
     /// @brief Acquire access to the shared resource
     /// @return A scoped_access token
-    [[nodiscard]] auto access() -> scoped_access<T, Mutex> { return {resource_, mutex_}; }
+    [[nodiscard]] auto access() -> scoped_access<T, Mutex>
+    {
+        return acquire<scoped_access<T, Mutex>>();
+    }
 
     /// @brief Acquire access to the shared resource within a timeout
     /// @tparam Rep Duration representation type
@@ -102,7 +656,115 @@ class shared_resource {
     [[nodiscard]] auto access_within(const std::chrono::duration<Rep, Period>& duration)
         -> scoped_access<T, Mutex>
     {
-        return {resource_, mutex_, duration};
+        return acquire_within<scoped_access<T, Mutex>>(duration);
+    }
+
+    /// @brief Acquire access to the shared resource within a timeout, without
+    ///     throwing
+    /// @tparam Rep Duration representation type
+    /// @tparam Period Duration period type
+    /// @param duration Elapsed time to wait for
+    /// @param ec Set to `std::errc::timed_out` if access is not acquired
+    ///     before the timeout, to `slots_exceeded_error()` if the mutex fails
+    ///     to obtain a slot, otherwise cleared
+    /// @return A scoped_access token, which owns the lock if `ec` is cleared
+    ///
+    /// Similar to `access_within`, but reports failures with an error code.
+    /// Usable when exceptions are disabled.
+    template <class Rep, class Period>
+    [[nodiscard]] auto try_access_within(const std::chrono::duration<Rep, Period>& duration,
+                                         std::error_code& ec) -> scoped_access<T, Mutex>
+    {
+        ec.clear();
+
+        auto locked = false;
+        if constexpr (detail::has_waiter_v<Mutex>) {
+            locked = lock_until(std::chrono::steady_clock::now() + duration, ec);
+        } else {
+            locked = mutex_.try_lock_for(duration);
+        }
+
+        if (locked) {
+            return scoped_access<T, Mutex>{resource_, mutex_, std::adopt_lock};
+        }
+
+        if (!ec) {
+            ec = std::make_error_code(std::errc::timed_out);
+        }
+        return scoped_access<T, Mutex>{resource_, mutex_, std::defer_lock};
+    }
+
+    /// @brief Acquire access to the shared resource with a hold budget
+    /// @tparam Rep Duration representation type
+    /// @tparam Period Duration period type
+    /// @param hold_budget Expected upper bound on the time access is held
+    /// @param holder Optional label identifying the holder in overrun reports
+    /// @return A leased_access token
+    ///
+    /// If access is held for longer than `hold_budget`, the overrun is counted
+    /// and passed to the overrun handler. If the mutex supports it (e.g.
+    /// `clh_mutex`), threads waiting on the resource detect the overrun
+    /// while access is still held. Otherwise, it is detected when access is
+    /// released.
+    ///
+    /// Only available if leases are enabled by `resource_lease<T, Mutex>`.
+    template <class Rep,
+              class Period,
+              bool Leased = is_leased,
+              class = std::enable_if_t<Leased>>
+    [[nodiscard]] auto access_for(const std::chrono::duration<Rep, Period>& hold_budget,
+                                  const char* holder = nullptr) -> leased_access<T, Mutex>
+    {
+        return acquire<leased_access<T, Mutex>>(
+            this->lease_monitor_,
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(hold_budget),
+            holder);
+    }
+
+    /// @brief Acquire transferable access to the shared resource
+    /// @return A transferable_access token
+    ///
+    /// Only available if the mutex is transferable.
+    template <class M = Mutex, class = std::enable_if_t<is_transferable_v<M>>>
+    [[nodiscard]] auto access_transferable() -> transferable_access<T, Mutex>
+    {
+        return acquire<transferable_access<T, Mutex>>();
+    }
+
+    /// @brief Acquire transferable access to the shared resource within a timeout
+    /// @tparam Rep Duration representation type
+    /// @tparam Period Duration period type
+    /// @param duration Elapsed time to wait for
+    /// @return A transferable_access token, which owns the lock on success
+    ///
+    /// Only available if the mutex is transferable. See `access_within`.
+    template <class Rep,
+              class Period,
+              class M = Mutex,
+              class = std::enable_if_t<is_transferable_v<M>>>
+    [[nodiscard]] auto access_transferable_within(const std::chrono::duration<Rep, Period>& duration)
+        -> transferable_access<T, Mutex>
+    {
+        return acquire_within<transferable_access<T, Mutex>>(duration);
+    }
+
+    /// @brief Set the callback for access leases that exceed their hold budget
+    /// @param handler Callback, or `nullptr` to only count overruns
+    ///
+    /// Only available if leases are enabled by `resource_lease<T, Mutex>`.
+    template <bool Leased = is_leased, class = std::enable_if_t<Leased>>
+    auto set_overrun_handler(overrun_handler handler) -> void
+    {
+        this->lease_monitor_.set_handler(handler);
+    }
+
+    /// @brief Obtain the number of access leases that exceeded their hold budget
+    ///
+    /// Only available if leases are enabled by `resource_lease<T, Mutex>`.
+    template <bool Leased = is_leased, class = std::enable_if_t<Leased>>
+    [[nodiscard]] auto overrun_count() const -> unsigned int
+    {
+        return this->lease_monitor_.overrun_count();
     }
 
     /// @brief Obtain the queue count on the shared resource
@@ -114,4 +776,337 @@ class shared_resource {
     }
 };
 
+/// @brief Scoped access token for multiple shared resources
+/// @tparam Resources `shared_resource` types
+///
+/// Wrapper type providing RAII mechanism for simultaneous access to several
+/// shared resources. Mutexes are acquired in a global order (by address) so
+/// that overlapping calls cannot deadlock. Access is acquired for either all
+/// of the resources or none of them.
+///
+/// This type is only intended to be created by `access_all` or
+/// `access_all_within`.
+template <class... Resources>
+class scoped_access_all {
+    static_assert(sizeof...(Resources) > 0);
+    static_assert(detail::covers_nested_holds_v<typename Resources::mutex_type...>,
+                  "Shared node pools must have a node for each resource.");
+
+    std::tuple<std::unique_lock<typename Resources::mutex_type>...> locks_;
+    std::tuple<Resources*...> resources_;
+
+    // Leased resources are waited on with `lock_until`, so that the lease of
+    // the current holder is checked while waiting
+    template <class Resource>
+    static constexpr auto checks_lease =
+        Resource::is_leased && detail::has_waiter_v<typename Resource::mutex_type>;
+
+    template <class Resource, class Lock, class Clock, class Duration>
+    static auto try_lock_until(Resource& r,
+                               Lock& lk,
+                               const std::chrono::time_point<Clock, Duration>& deadline) -> bool
+    {
+        if constexpr (checks_lease<Resource>) {
+            if (!r.lock_until(deadline)) {
+                return false;
+            }
+            lk = Lock{r.mutex_, std::adopt_lock};
+            return true;
+        } else {
+            return lk.try_lock_until(deadline);
+        }
+    }
+
+    template <class Resource, class Lock>
+    static auto lock(Resource& r, Lock& lk) -> void
+    {
+        if constexpr (checks_lease<Resource>) {
+            try_lock_until(r, lk, std::chrono::steady_clock::time_point::max());
+        } else {
+            lk.lock();
+        }
+    }
+
+    // Pairs each resource with its lock, in argument order
+    template <std::size_t... Is>
+    auto slots(std::index_sequence<Is...>)
+    {
+        return std::tuple{std::pair{std::get<Is>(resources_), &std::get<Is>(locks_)}...};
+    }
+
+    template <class... Ts, class... Mutexes>
+    friend auto access_all(shared_resource<Ts, Mutexes>&... resources)
+        -> scoped_access_all<shared_resource<Ts, Mutexes>...>;
+
+    template <class Rep, class Period, class... Ts, class... Mutexes>
+    friend auto access_all_within(const std::chrono::duration<Rep, Period>& duration,
+                                  shared_resource<Ts, Mutexes>&... resources)
+        -> scoped_access_all<shared_resource<Ts, Mutexes>...>;
+
+    explicit scoped_access_all(Resources&... rs)
+        : locks_{std::unique_lock{rs.mutex_, std::defer_lock}...}, resources_{&rs...}
+    {
+        auto s = slots(std::index_sequence_for<Resources...>{});
+
+        for (auto i : detail::lock_order(locks_)) {
+            detail::visit_at(s, i, [](auto& slot) {
+                lock(*slot.first, *slot.second);
+                return true;
+            });
+        }
+    }
+
+    template <class Clock, class Duration>
+    scoped_access_all(const std::chrono::time_point<Clock, Duration>& deadline, Resources&... rs)
+        : locks_{std::unique_lock{rs.mutex_, std::defer_lock}...}, resources_{&rs...}
+    {
+        auto s = slots(std::index_sequence_for<Resources...>{});
+
+        for (auto i : detail::lock_order(locks_)) {
+            if (!detail::visit_at(s, i, [&deadline](auto& slot) {
+                    return try_lock_until(*slot.first, *slot.second, deadline);
+                })) {
+                // back off, a partial hold would only stall other threads
+                detail::unlock_all(locks_);
+                return;
+            }
+        }
+    }
+
+  public:
+    ~scoped_access_all() = default;
+
+    scoped_access_all(const scoped_access_all&) = delete;
+    scoped_access_all(scoped_access_all&&) = delete;
+    auto operator=(const scoped_access_all&) -> scoped_access_all& = delete;
+    auto operator=(scoped_access_all&&) -> scoped_access_all& = delete;
+
+    /// @{
+    /// @brief Checks whether `*this` acquired access to all resources
+    [[nodiscard]] auto owns_lock() const noexcept -> bool
+    {
+        return std::get<0>(locks_).owns_lock();
+    }
+    [[nodiscard]] explicit operator bool() const noexcept { return owns_lock(); }
+    /// @}
+
+    /// @brief Access the shared resources
+    /// @return A tuple of references, in the order the resources were given
+    /// @pre `owns_lock()` returns `true`
+    ///
+    /// Users are expected *not* to store the underlying references.
+    [[nodiscard]] auto operator*() const -> std::tuple<typename Resources::resource_type&...>
+    {
+        assert(*this);
+        return std::apply([](auto*... r) { return std::tie(r->resource_...); }, resources_);
+    }
+};
+
+/// @brief Acquire access to multiple shared resources
+/// @param resources Distinct shared resources
+/// @return A scoped_access_all token
+///
+/// Blocks until access to all resources is acquired. Resources are locked in
+/// a global order, independent of argument order.
+template <class... Ts, class... Mutexes>
+[[nodiscard]] auto access_all(shared_resource<Ts, Mutexes>&... resources)
+    -> scoped_access_all<shared_resource<Ts, Mutexes>...>
+{
+    return scoped_access_all<shared_resource<Ts, Mutexes>...>{resources...};
+}
+
+/// @brief Acquire access to multiple shared resources within a timeout
+/// @tparam Rep Duration representation type
+/// @tparam Period Duration period type
+/// @param duration Elapsed time to wait for
+/// @param resources Distinct shared resources
+/// @return A scoped_access_all token, which owns all locks on success and none on
+/// failure
+///
+/// Attempts to acquire exclusive access to all resources within a duration,
+/// with respect to `std::chrono::steady_clock`. If the duration elapses
+/// before every resource is acquired, any resources already acquired are
+/// released.
+template <class Rep, class Period, class... Ts, class... Mutexes>
+[[nodiscard]] auto access_all_within(const std::chrono::duration<Rep, Period>& duration,
+                                     shared_resource<Ts, Mutexes>&... resources)
+    -> scoped_access_all<shared_resource<Ts, Mutexes>...>
+{
+    return scoped_access_all<shared_resource<Ts, Mutexes>...>{
+        std::chrono::steady_clock::now() + duration, resources...};
+}
+
+/// @brief Scoped access token for one of several shared resources
+/// @tparam T Resource type
+/// @tparam Mutex Mutex type
+///
+/// Wrapper type providing RAII mechanism for access to whichever of several
+/// shared resources is granted first.
+///
+/// This type is only intended to be created by `access_any` or
+/// `access_any_within`.
+template <class T, class Mutex>
+class scoped_access_any {
+    std::unique_lock<Mutex> lock_;
+    T* resource_;
+    std::size_t index_;
+
+    template <class U, class M, class... Resources>
+    friend auto access_any(shared_resource<U, M>& resource, Resources&... resources)
+        -> scoped_access_any<U, M>;
+
+    template <class Rep, class Period, class U, class M, class... Resources>
+    friend auto access_any_within(const std::chrono::duration<Rep, Period>& duration,
+                                  shared_resource<U, M>& resource,
+                                  Resources&... resources) -> scoped_access_any<U, M>;
+
+    template <class Clock, class Duration, std::size_t N>
+    scoped_access_any(const std::chrono::time_point<Clock, Duration>& deadline,
+                      const std::array<shared_resource<T, Mutex>*, N>& resources)
+        : scoped_access_any(acquire_any(deadline, resources), resources)
+    {}
+
+    template <std::size_t N>
+    scoped_access_any(std::size_t index,
+                      const std::array<shared_resource<T, Mutex>*, N>& resources)
+        : lock_{index < N ? std::unique_lock<Mutex>{resources[index]->mutex_, std::adopt_lock}
+                          : std::unique_lock<Mutex>{}},
+          resource_{index < N ? &resources[index]->resource_ : nullptr},
+          index_{index}
+    {}
+
+    // Queues on every mutex, returning the index of the first mutex acquired,
+    // or N if none are acquired before the deadline. All other queues are
+    // abandonned, including if queuing on a later mutex fails, before the
+    // failure is raised.
+    template <class Clock, class Duration, std::size_t N>
+    static auto acquire_any(const std::chrono::time_point<Clock, Duration>& deadline,
+                            const std::array<shared_resource<T, Mutex>*, N>& resources)
+        -> std::size_t
+    {
+        static_assert(detail::shared_node_pool<Mutex>::size == 0U ||
+                          N <= detail::shared_node_pool<Mutex>::size,
+                      "Shared node pools must have a node for each resource.");
+
+        auto ec = std::error_code{};
+
+        auto waiters = std::array<typename Mutex::waiter, N>{};
+        for (auto i = std::size_t{}; i != N; ++i) {
+            waiters[i] = resources[i]->mutex_.enqueue_until(deadline, ec);
+            if (ec) {
+                break;
+            }
+        }
+
+        auto acquired = N;
+        while (!ec && (acquired == N)) {
+            for (auto i = std::size_t{}; i != N; ++i) {
+                if (waiters[i] && resources[i]->mutex_.poll(waiters[i])) {
+                    acquired = i;
+                    break;
+                }
+            }
+
+            if (acquired == N) {
+                if constexpr (shared_resource<T, Mutex>::is_leased) {
+                    const auto now = std::chrono::steady_clock::now();
+                    for (auto* r : resources) {
+                        r->check_lease(now);
+                    }
+                }
+
+                if (Clock::now() >= deadline) {
+                    break;
+                }
+            }
+        }
+
+        for (auto i = std::size_t{}; i != N; ++i) {
+            if (waiters[i]) {
+                resources[i]->mutex_.abandon(waiters[i]);
+            }
+        }
+
+        if (ec) {
+            detail::raise(ec);
+        }
+
+        return acquired;
+    }
+
+  public:
+    ~scoped_access_any() = default;
+
+    scoped_access_any(const scoped_access_any&) = delete;
+    scoped_access_any(scoped_access_any&&) = delete;
+    auto operator=(const scoped_access_any&) -> scoped_access_any& = delete;
+    auto operator=(scoped_access_any&&) -> scoped_access_any& = delete;
+
+    /// @{
+    /// @brief Checks whether `*this` acquired access
+    [[nodiscard]] auto owns_lock() const noexcept -> bool { return lock_.owns_lock(); }
+    [[nodiscard]] explicit operator bool() const noexcept { return owns_lock(); }
+    /// @}
+
+    /// @brief Index of the acquired resource, in argument order
+    /// @pre `owns_lock()` returns `true`
+    [[nodiscard]] auto index() const -> std::size_t
+    {
+        assert(*this);
+        return index_;
+    }
+
+    /// @brief Access the acquired shared resource
+    /// @pre `owns_lock()` returns `true`
+    ///
+    /// Users are expected *not* to store the underlying reference.
+    [[nodiscard]] auto operator*() const -> T&
+    {
+        assert(*this);
+        return *resource_;
+    }
+};
+
+/// @brief Acquire access to the first available of several shared resources
+/// @param resource, resources Distinct shared resources with the same type
+/// @return A scoped_access_any token
+///
+/// Queues on all resources at once and blocks until one of them is acquired.
+/// The thread then leaves the queues of the other resources.
+///
+/// @note Mutex must support waiting on multiple locks (e.g. `clh_mutex`)
+template <class T, class Mutex, class... Resources>
+[[nodiscard]] auto access_any(shared_resource<T, Mutex>& resource, Resources&... resources)
+    -> scoped_access_any<T, Mutex>
+{
+    static_assert((std::is_same_v<shared_resource<T, Mutex>, Resources> && ...));
+
+    return scoped_access_any<T, Mutex>{std::chrono::steady_clock::time_point::max(),
+                                       std::array{&resource, &resources...}};
+}
+
+/// @brief Acquire access to the first available of several shared resources
+/// within a timeout
+/// @tparam Rep Duration representation type
+/// @tparam Period Duration period type
+/// @param duration Elapsed time to wait for
+/// @param resource, resources Distinct shared resources with the same type
+/// @return A scoped_access_any token, which owns a lock on success
+///
+/// Queues on all resources at once until one of them is acquired or the
+/// duration elapses, with respect to `std::chrono::steady_clock`. The
+/// thread then leaves the queues of all resources not acquired.
+///
+/// @note Mutex must support waiting on multiple locks (e.g. `clh_mutex`)
+template <class Rep, class Period, class T, class Mutex, class... Resources>
+[[nodiscard]] auto access_any_within(const std::chrono::duration<Rep, Period>& duration,
+                                     shared_resource<T, Mutex>& resource,
+                                     Resources&... resources) -> scoped_access_any<T, Mutex>
+{
+    static_assert((std::is_same_v<shared_resource<T, Mutex>, Resources> && ...));
+
+    return scoped_access_any<T, Mutex>{std::chrono::steady_clock::now() + duration,
+                                       std::array{&resource, &resources...}};
+}
+
 }  // namespace exclusive
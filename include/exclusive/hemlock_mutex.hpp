@@ -0,0 +1,106 @@
+#pragma once
+
+#include "interference_size.hpp"
+
+#include <atomic>
+
+/// @brief Provides exclusive access to shared resources
+namespace exclusive {
+
+namespace detail {
+
+/// Grant word of a thread, shared by all hemlock_mutexes the thread uses
+struct alignas(hardware_destructive_interference_size) hemlock_grant {
+    /// Set to the address of a lock being passed to the successor
+    std::atomic<const void*> lock{};
+
+    static auto self() -> hemlock_grant*
+    {
+        thread_local auto grant = hemlock_grant{};
+        return &grant;
+    }
+};
+
+}  // namespace detail
+
+/// @brief Mutex implementing a Hemlock queue lock
+///
+/// A queue lock where each lock is a single tail pointer and each thread has
+/// a single grant word, used for all locks held by the thread. Waiters spin
+/// on the grant word of their predecessor, waiting for it to be set to the
+/// address of the lock. Locks are granted in FIFO order.
+///
+/// Unlike `clh_mutex`, no nodes are stored in the lock, so per-lock memory is
+/// constant.
+///
+/// Similar to Hemlock described by Dice and Kogan.
+///
+/// @note Implements Lockable. A lock must be unlocked by the thread that
+///     locked it.
+class hemlock_mutex {
+    using grant = detail::hemlock_grant;
+
+    std::atomic<grant*> tail_{};
+
+  public:
+    hemlock_mutex() { tail_.store(nullptr, std::memory_order_relaxed); }
+
+    ~hemlock_mutex() = default;
+
+    hemlock_mutex(const hemlock_mutex&) = delete;
+    hemlock_mutex(hemlock_mutex&&) = delete;
+    auto operator=(const hemlock_mutex&) -> hemlock_mutex& = delete;
+    auto operator=(hemlock_mutex&&) -> hemlock_mutex& = delete;
+
+    auto lock() -> void
+    {
+        // (H1) swap predecessor with self
+        // synchronizes with (H1), (H2)
+        auto* pred = tail_.exchange(grant::self(), std::memory_order_acq_rel);
+
+        if (pred == nullptr) {
+            return;
+        }
+
+        // (H3) wait for the predecessor to pass this lock
+        // synchronizes with (H4)
+        while (pred->lock.load(std::memory_order_acquire) != this) {}
+
+        // (H5) acknowledge receipt, allowing the predecessor to reuse its grant
+        // synchronizes with (H6)
+        pred->lock.store(nullptr, std::memory_order_release);
+    }
+
+    auto try_lock() -> bool
+    {
+        auto* expected = static_cast<grant*>(nullptr);
+
+        // (H1) swap predecessor with self
+        // synchronizes with (H1), (H2)
+        return tail_.compare_exchange_strong(
+            expected, grant::self(), std::memory_order_acq_rel, std::memory_order_relaxed);
+    }
+
+    auto unlock() -> void
+    {
+        auto* self = grant::self();
+        auto* expected = self;
+
+        // (H2) release the lock if there are no waiters
+        // synchronizes with (H1)
+        if (tail_.compare_exchange_strong(
+                expected, nullptr, std::memory_order_release, std::memory_order_relaxed)) {
+            return;
+        }
+
+        // (H4) pass the lock to the successor
+        // synchronizes with (H3)
+        self->lock.store(this, std::memory_order_release);
+
+        // (H6) wait for the successor to acknowledge
+        // synchronizes with (H5)
+        while (self->lock.load(std::memory_order_acquire) != nullptr) {}
+    }
+};
+
+}  // namespace exclusive
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "interference_size.hpp"
+#include "mutex.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/// @brief Provides exclusive access to shared resources
+namespace exclusive {
+
+/// @brief Mutex with a test-and-set fast path in front of a queue lock
+///
+/// @tparam N Number of nodes in the queue lock pool. Should match the number
+///     of concurrent threads accessing the lock.
+/// @tparam Failure Policy for the queue lock when no node is available
+/// @tparam Pool Node pool policy for the queue lock
+///
+/// An uncontended lock is acquired with a single compare-and-swap on a lock
+/// word. If the lock is held, the first contending thread sets a pending bit
+/// and spins on the lock word, without allocating a queue node. Further
+/// contending threads queue on a `clh_mutex`, and only the head of the queue
+/// spins on the lock word, waiting for both the holder and the pending thread
+/// to finish.
+///
+/// Similar to the Linux kernel's `qspinlock`. Unlike `clh_mutex`, locks are
+/// not granted in FIFO order: a thread arriving while the lock word is free
+/// acquires it ahead of queued threads.
+///
+/// @note Implements TimedMutex
+template <std::size_t N, class Failure = failure::retry, class Pool = pool::local>
+class hybrid_mutex {
+    static constexpr std::uint8_t locked = 1U;
+    static constexpr std::uint8_t pending = 2U;
+
+    alignas(hardware_destructive_interference_size) std::atomic<std::uint8_t> state_{};
+
+    clh_mutex<N, Failure, Pool> queue_;
+
+    auto try_acquire_word() -> bool
+    {
+        auto s = std::uint8_t{};
+
+        // (Q1) acquire the lock word
+        // synchronizes with (Q2)
+        return state_.compare_exchange_strong(
+            s, locked, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    // Sets the pending bit if the lock is held and no other thread is waiting
+    auto try_set_pending() -> bool
+    {
+        auto s = locked;
+
+        return (queue_.queue_count() == 0U) &&
+               state_.compare_exchange_strong(s,
+                                              static_cast<std::uint8_t>(locked | pending),
+                                              std::memory_order_relaxed,
+                                              std::memory_order_relaxed);
+    }
+
+    // Spins as the pending thread until the holder releases the lock
+    template <class Expired>
+    auto acquire_pending(Expired expired) -> bool
+    {
+        // (Q3) wait for the holder to release the lock
+        // synchronizes with (Q2)
+        while (state_.load(std::memory_order_acquire) != pending) {
+            if (expired()) {
+                state_.fetch_and(static_cast<std::uint8_t>(~pending), std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        // No other thread modifies the lock word while the pending bit is set
+        state_.store(locked, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Spins as the head of the queue until the lock word is acquired
+    template <class Expired>
+    auto acquire_queued(Expired expired) -> bool
+    {
+        while (!((state_.load(std::memory_order_relaxed) == 0U) && try_acquire_word())) {
+            if (expired()) {
+                queue_.unlock();
+                return false;
+            }
+        }
+
+        queue_.unlock();
+        return true;
+    }
+
+  public:
+    hybrid_mutex() { state_.store(0U, std::memory_order_relaxed); }
+
+    ~hybrid_mutex() = default;
+
+    hybrid_mutex(const hybrid_mutex&) = delete;
+    hybrid_mutex(hybrid_mutex&&) = delete;
+    auto operator=(const hybrid_mutex&) -> hybrid_mutex& = delete;
+    auto operator=(hybrid_mutex&&) -> hybrid_mutex& = delete;
+
+    auto lock() -> void
+    {
+        if (try_acquire_word()) {
+            return;
+        }
+
+        const auto never = [] { return false; };
+
+        if (try_set_pending()) {
+            acquire_pending(never);
+            return;
+        }
+
+        queue_.lock();
+        acquire_queued(never);
+    }
+
+    auto try_lock() -> bool { return try_acquire_word(); }
+
+    template <class Rep, class Period>
+    auto try_lock_for(const std::chrono::duration<Rep, Period>& duration) -> bool
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    template <class Clock, class Duration>
+    auto try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline) -> bool
+    {
+        if (try_acquire_word()) {
+            return true;
+        }
+
+        const auto expired = [&deadline] { return Clock::now() >= deadline; };
+
+        if (try_set_pending()) {
+            return acquire_pending(expired);
+        }
+
+        return queue_.try_lock_until(deadline) && acquire_queued(expired);
+    }
+
+    auto unlock() -> void
+    {
+        // (Q2) release the lock word, leaving the pending bit
+        // synchronizes with (Q1), (Q3)
+        state_.fetch_and(static_cast<std::uint8_t>(~locked), std::memory_order_release);
+    }
+
+    /// @brief Current number of threads waiting on the queue
+    /// NOTE: May be inaccurate due to racing
+    [[nodiscard]] auto queue_count() const -> unsigned int { return queue_.queue_count(); }
+};
+
+template <std::size_t N, class Failure, class Pool>
+struct is_transferable<hybrid_mutex<N, Failure, Pool>> : std::true_type {};
+
+}  // namespace exclusive
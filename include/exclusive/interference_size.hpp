@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+
+#if __has_include("exclusive/config/cache_geometry.hpp")
+#include "exclusive/config/cache_geometry.hpp"
+#endif
+
+/// @brief Provides exclusive access to shared resources
+namespace exclusive {
+
+// Cache geometry of the host, detected when configuring the build. Otherwise,
+// a guess based on the target architecture, using the same fallback as
+// configure.bzl. The `std::hardware_*` constants are not used as they may
+// change with compiler flags (-Winterference-size) and are not provided by
+// all standard libraries.
+#if __has_include("exclusive/config/cache_geometry.hpp")
+inline constexpr std::size_t cache_line_size = config::cache_line_size;
+inline constexpr std::size_t prefetch_pair_size = config::prefetch_pair_size;
+#elif defined(__x86_64__) || defined(__i386__)
+inline constexpr std::size_t cache_line_size = 64;
+inline constexpr std::size_t prefetch_pair_size = 128;
+#elif defined(__aarch64__)
+inline constexpr std::size_t cache_line_size = 128;
+inline constexpr std::size_t prefetch_pair_size = 128;
+#else
+inline constexpr std::size_t cache_line_size = 64;
+inline constexpr std::size_t prefetch_pair_size = 64;
+#endif
+
+static_assert((cache_line_size & (cache_line_size - 1U)) == 0U,
+              "Cache line size must be a power of 2.");
+static_assert((prefetch_pair_size % cache_line_size) == 0U,
+              "Prefetch pair size must be a multiple of the cache line size.");
+
+/// Minimum offset between objects written by different threads to avoid false
+/// sharing
+inline constexpr std::size_t hardware_destructive_interference_size = cache_line_size;
+
+/// Minimum offset between objects spun on by different threads. Also avoids
+/// adjacent-line prefetching pulling in a line written by another thread.
+inline constexpr std::size_t hardware_prefetch_interference_size = prefetch_pair_size;
+
+}  // namespace exclusive
@@ -0,0 +1,235 @@
+#pragma once
+
+#include "interference_size.hpp"
+#include "mutex.hpp"
+#include "parking_lot.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/// @brief Provides exclusive access to shared resources
+namespace exclusive {
+
+/// @brief Queue lock restricting the number of circulating threads
+///
+/// @tparam Active Maximum number of threads queued on or holding the lock
+/// @tparam Rotation Number of acquisitions after which the lock holder hands
+///     its place in the active set to the longest parked thread
+///
+/// Threads acquire one of `Active` slots before queueing on a `clh_mutex`.
+/// While all slots are taken, surplus threads park in the process-wide
+/// `parking_lot`, keyed by the address of the mutex, and do not contend for
+/// the lock or keep their working sets hot. Parked threads are admitted in
+/// FIFO order once the active set drains, or when a thread leaves the active
+/// set while another slot is free. While the active set is saturated, the
+/// lock holder hands its place to a parked thread every `Rotation`
+/// acquisitions, so that no thread is excluded indefinitely.
+///
+/// As at most `Active` threads enter the queue lock, its node pool is sized
+/// for `Active` threads rather than the total number of threads.
+///
+/// Similar to the Malthusian lock MCSCR described by Dice.
+///
+/// @note Implements TimedMutex
+template <std::size_t Active = 2, std::size_t Rotation = 256>
+class malthusian_mutex {
+    static_assert(Active > 0, "Active must be greater than 0.");
+    static_assert(Rotation > 0, "Rotation must be greater than 0.");
+
+    // Token passed to a parked thread that is given a slot
+    static constexpr auto admitted = std::uintptr_t{1};
+
+    // Number of threads holding a slot
+    alignas(hardware_destructive_interference_size) std::atomic<std::size_t> active_{};
+
+    // Number of threads parked or about to park
+    std::atomic<std::size_t> passive_{};
+
+    // Acquisitions since a parked thread was last admitted. Only accessed by
+    // the lock holder.
+    std::size_t acquisitions_{};
+
+    clh_mutex<Active> queue_;
+
+    auto try_acquire_slot() -> bool
+    {
+        auto n = active_.load(std::memory_order_relaxed);
+
+        while (n < Active) {
+            if (active_.compare_exchange_weak(
+                    n, n + 1U, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template <class Park, class Expired>
+    auto acquire_slot(Park park, Expired expired) -> bool
+    {
+        for (;;) {
+            if (try_acquire_slot()) {
+                return true;
+            }
+
+            if (expired()) {
+                return false;
+            }
+
+            // (M1) announce parking
+            // ordered with (M4)
+            passive_.fetch_add(1U, std::memory_order_seq_cst);
+
+            auto token = std::uintptr_t{};
+            const auto result = park(token);
+
+            passive_.fetch_sub(1U, std::memory_order_relaxed);
+
+            if (result == parking_lot::park_result::unparked && token == admitted) {
+                return true;
+            }
+            if (result == parking_lot::park_result::timeout) {
+                return false;
+            }
+        }
+    }
+
+    [[nodiscard]] auto should_park() const -> bool
+    {
+        // (M2) check for a free slot
+        // ordered with (M3)
+        return active_.load(std::memory_order_seq_cst) >= Active;
+    }
+
+    auto release_slot() -> void
+    {
+        // (M3) release the slot
+        // ordered with (M2)
+        const auto n = active_.fetch_sub(1U, std::memory_order_seq_cst) - 1U;
+
+        // Reprovision from the parked threads once the active set drains, or
+        // while a slot other than the one just released is free. The
+        // releasing thread may take its own slot again.
+        //
+        // (M4) check for parked threads
+        // ordered with (M1)
+        if (((n == 0U) || (n + 1U < Active)) &&
+            (passive_.load(std::memory_order_seq_cst) != 0U)) {
+            parking_lot::unpark_one(this, [this](auto result) {
+                // Another thread may have taken the slot since it was released
+                return (result.unparked && try_acquire_slot()) ? admitted : std::uintptr_t{};
+            });
+        }
+    }
+
+    auto leave(bool rotate) -> void
+    {
+        if (!rotate || (passive_.load(std::memory_order_relaxed) == 0U)) {
+            release_slot();
+            return;
+        }
+
+        auto handed_off = false;
+        parking_lot::unpark_one(this, [&handed_off](auto result) {
+            handed_off = result.unparked;
+            return admitted;
+        });
+
+        if (!handed_off) {
+            release_slot();
+        }
+    }
+
+  public:
+    malthusian_mutex()
+    {
+        active_.store(0U, std::memory_order_relaxed);
+        passive_.store(0U, std::memory_order_relaxed);
+    }
+
+    ~malthusian_mutex() = default;
+
+    malthusian_mutex(const malthusian_mutex&) = delete;
+    malthusian_mutex(malthusian_mutex&&) = delete;
+    auto operator=(const malthusian_mutex&) -> malthusian_mutex& = delete;
+    auto operator=(malthusian_mutex&&) -> malthusian_mutex& = delete;
+
+    auto lock() -> void
+    {
+        acquire_slot(
+            [this](auto& token) {
+                return parking_lot::park(
+                    this, [this] { return should_park(); }, &token);
+            },
+            [] { return false; });
+
+        queue_.lock();
+    }
+
+    auto try_lock() -> bool
+    {
+        if (!try_acquire_slot()) {
+            return false;
+        }
+
+        if (!queue_.try_lock()) {
+            release_slot();
+            return false;
+        }
+
+        return true;
+    }
+
+    template <class Rep, class Period>
+    auto try_lock_for(const std::chrono::duration<Rep, Period>& duration) -> bool
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    template <class Clock, class Duration>
+    auto try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline) -> bool
+    {
+        if (!acquire_slot(
+                [this, &deadline](auto& token) {
+                    return parking_lot::park_until(
+                        this, [this] { return should_park(); }, deadline, &token);
+                },
+                [&deadline] { return Clock::now() >= deadline; })) {
+            return false;
+        }
+
+        if (!queue_.try_lock_until(deadline)) {
+            release_slot();
+            return false;
+        }
+
+        return true;
+    }
+
+    auto unlock() -> void
+    {
+        const auto rotate = (++acquisitions_ == Rotation);
+        if (rotate) {
+            acquisitions_ = 0U;
+        }
+
+        queue_.unlock();
+        leave(rotate);
+    }
+
+    /// @brief Number of threads parked outside of the active set
+    /// NOTE: May be inaccurate due to racing
+    [[nodiscard]] auto passive() const -> std::size_t
+    {
+        return passive_.load(std::memory_order_relaxed);
+    }
+};
+
+template <std::size_t Active, std::size_t Rotation>
+struct is_transferable<malthusian_mutex<Active, Rotation>> : std::true_type {};
+
+}  // namespace exclusive
@@ -1,31 +1,74 @@
 #pragma once
 
+#include "interference_size.hpp"
+#include "parking_lot.hpp"
+
 #include <algorithm>
 #include <array>
 #include <atomic>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
-#include <new>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <memory>
 #include <system_error>
+#include <thread>
 #include <type_traits>
 
 /// @brief Provides exclusive access to shared resources
 namespace exclusive {
 
-inline auto error_on_slots_exceeded()
+/// @brief Error reported when a mutex has no available slots or nodes
+inline auto slots_exceeded_error() -> std::error_code
 {
-    return std::system_error{std::make_error_code(std::errc::device_or_resource_busy)};
+    return std::make_error_code(std::errc::device_or_resource_busy);
 }
 
-// Apple Clang =/
-// https://en.cppreference.com/w/cpp/thread/hardware_destructive_interference_size
-#if defined(__cpp_lib_hardware_interference_size) && !defined(__APPLE__)
-using std::hardware_destructive_interference_size;
+inline auto error_on_slots_exceeded() { return std::system_error{slots_exceeded_error()}; }
+
+namespace detail {
+
+/// Throws `std::system_error`, or aborts if exceptions are disabled
+[[noreturn]] inline auto raise(std::error_code ec) -> void
+{
+#if defined(__cpp_exceptions)
+    throw std::system_error{ec};
 #else
-// 64 bytes on x86-64 │ L1_CACHE_BYTES │ L1_CACHE_SHIFT │ __cacheline_aligned │ ...
-constexpr std::size_t hardware_destructive_interference_size = 2 * sizeof(std::max_align_t);
+    (void)ec;
+    std::abort();
+#endif
+}
+
+/// Hints to the processor that the calling thread is spinning
+///
+/// Shared by mutexes that spin on a lock word, such as the small `clh_mutex`
+/// specializations and `ticket_mutex`.
+inline auto cpu_relax() -> void
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield");
 #endif
+}
+
+}  // namespace detail
+
+/// @brief Pool size of a mutex that is determined at construction
+inline constexpr auto dynamic_extent = std::numeric_limits<std::size_t>::max();
+
+/// @brief Checks whether a mutex may be unlocked by a thread other than the
+/// one that locked it
+///
+/// Allows ownership of a locked mutex to be passed between threads. This is
+/// not the case for standard library mutexes.
+template <class Mutex>
+struct is_transferable : std::false_type {};
+
+template <class Mutex>
+inline constexpr bool is_transferable_v = is_transferable<Mutex>::value;
 
 /// @brief Array-based queue mutex
 /// @tparam N Number of slots
@@ -35,7 +78,7 @@ template <std::size_t N>
 class array_mutex {
     static_assert((std::size_t(-1) % N) == (N - 1U), "N must be a power of 2.");
 
-    struct alignas(hardware_destructive_interference_size) cache_bool {
+    struct alignas(hardware_prefetch_interference_size) cache_bool {
         std::atomic_bool value{};
         std::atomic_flag in_use{};
     };
@@ -77,11 +120,26 @@ class array_mutex {
     // TODO handle timeout?
     auto lock()
     {
+        auto ec = std::error_code{};
+        lock(ec);
+        if (ec) {
+            detail::raise(ec);
+        }
+    }
+
+    /// Locks the mutex, blocking until the mutex is available
+    /// @param ec Set to `slots_exceeded_error()` when N slots are already
+    ///     taken, otherwise cleared
+    auto lock(std::error_code& ec) -> void
+    {
+        ec.clear();
+
         auto slot = tail_.fetch_add(1, std::memory_order_relaxed) % N;
         while (!flag_[slot].value.load(std::memory_order_acquire)) {}
 
         if (flag_[slot].in_use.test_and_set()) {
-            throw error_on_slots_exceeded();
+            ec = slots_exceeded_error();
+            return;
         }
 
         active_ = slot;
@@ -100,273 +158,1405 @@ class array_mutex {
     auto try_lock();
 };
 
+template <std::size_t N>
+struct is_transferable<array_mutex<N>> : std::true_type {};
+
 /// Tag types for selecting behavior on lock failure
 namespace failure {
 struct retry {};
 struct die {};
+
+/// Wait in FIFO order for a node to be released, parking the thread
+struct wait {};
 }  // namespace failure
 
-/// @brief Mutex implementing a CLH Queue Lock
-///
-/// @tparam N Number of nodes in the fixed sized pool. Should match the number
-///     of concurrent threads accessing the lock. Additional nodes may be used
-///     for bookkeeping.
-/// @tparam Failure Policy when failing to obtain a node on calling lock. Must
-///     be `failure::retry` or `failure::die`.
-///
-/// Implements a mutex similar to CLH queue lock. This class manages a
-/// fixed-size pool of nodes instead of threads allocating a node when locking.
-/// A node will be recycled to the available pool of nodes after a thread
-/// unlocks.
+/// Tag types for selecting where the nodes of a `clh_mutex` are stored
+namespace pool {
+/// Nodes are stored in each mutex
+struct local {};
+
+/// Nodes are drawn from a process-wide pool, shared by all mutexes with the
+/// same pool size and `Group`
 ///
-/// @note Implements TimedMutex
-template <std::size_t N, class Failure = failure::retry>
-class clh_mutex {
-    static_assert(N > 0, "Number of nodes must be greater than 0.");
+/// A thread holds a node for every mutex of the group it waits on or holds,
+/// so the pool size must cover nested holds, e.g. `access_all` or
+/// `access_any` over several resources in the group, summed over all
+/// threads. Otherwise, threads may wait for a node forever. `access_all` and
+/// `access_any` check at compile time that a single call fits in the pool.
+template <class Group = void>
+struct shared {};
+
+/// Each thread owns a node, created on first use. A thread takes the node of
+/// its predecessor after acquiring the lock, as in a classic CLH queue lock.
+/// The pool size of the mutex is unused.
+struct thread_owned {};
+}  // namespace pool
+
+/// Tag types for selecting how a `clh_mutex` tracks its queue depth
+namespace depth {
+/// A queue count is updated with a read-modify-write when a thread joins or
+/// leaves the queue
+struct counted {};
+
+/// Each node is numbered when it joins the queue and the queue depth is
+/// derived from the numbers of the tail and holder nodes when requested. Adds
+/// no read-modify-write operations to locking and unlocking.
+struct ticketed {};
+}  // namespace depth
+
+namespace detail {
+
+struct alignas(hardware_prefetch_interference_size) clh_node {
+    /// Intrusive pointer to the next node. Used while a node is available.
+    std::atomic<clh_node*> next{};
+
+    /// The predecessor to wait on. Set if node is abandoned due to timeout.
+    /// Atomic as it may be inspected by `try_lock` while a node is recycled.
+    std::atomic<clh_node*> pred{};
+
+    /// Set if a thread is intending to acquire the lock
+    std::atomic_bool locked{};
+
+    /// Position in the queue. Only used with `depth::ticketed`.
+    std::atomic_size_t ticket{};
+};
 
-    static_assert(std::disjunction_v<std::is_same<failure::retry, Failure>,
-                                     std::is_same<failure::die, Failure>>);
+/// Node that is never locked. Used as the queue tail of a `clh_mutex` that
+/// does not hold any nodes.
+inline auto unlocked_clh_node() -> clh_node*
+{
+    static auto node = clh_node{};
+    return &node;
+}
 
-    /// A node queue for a clh_mutex with timeout
-    class queue {
-      public:
-        struct alignas(hardware_destructive_interference_size) node {
-            /// Intrusive pointer to the next node. Used while a node is available.
-            std::atomic<node*> next{};
+/// A node queue for a clh_mutex with timeout
+class clh_node_queue {
+  public:
+    /// Construct a queue, initializing with nodes from a separate pool
+    clh_node_queue(clh_node* first, clh_node* last)
+    {
+        assert(first != last);
+        assert(first != nullptr);
+
+        head_.store(first, std::memory_order_relaxed);
+
+        auto* prev = first;
+        while (++first != last) {
+            prev->next = first;
+            prev = first;
+        }
+
+        prev->next = nullptr;
+        tail_.store(prev, std::memory_order_relaxed);
+    }
+
+    auto push(clh_node* new_tail) -> void
+    {
+        new_tail->next.store(nullptr, std::memory_order_relaxed);
 
-            /// The predecessor to wait on. Set if node is abandoned due to timeout.
-            node* pred{};
+        // Nodes may be pushed by multiple threads, e.g. when shared between
+        // mutexes.
+        auto* t = tail_.exchange(new_tail, std::memory_order_acq_rel);
 
-            /// Set if a thread is intending to acquire the lock
-            std::atomic_bool locked{};
-        };
+        // (Q1) update old tail to point to the new tail
+        // synchronizes with (Q3)
+        t->next.store(new_tail, std::memory_order_release);
+    }
 
-        /// Construct a queue, initializing with nodes from a separate pool
-        queue(node* first, node* last)
-        {
-            assert(first != last);
-            assert(first != nullptr);
+    auto try_pop() -> clh_node*
+    {
+        // (Q2) grab the head node
+        // synchronizes with (Q4)
+        auto* h = head_.load(std::memory_order_acquire);
 
-            head_.store(first, std::memory_order_relaxed);
+        for (;;) {
+            // (Q3) if next is empty, give up
+            // synchronizes with (Q1)
+            auto* next = h->next.load(std::memory_order_acquire);
+            if (next == nullptr) {
+                return nullptr;
+            }
 
-            auto* prev = first;
-            while (++first != last) {
-                prev->next = first;
-                prev = first;
+            // (Q4) update head
+            // synchronizes with (Q2)
+            if (head_.compare_exchange_weak(
+                    h, next, std::memory_order_release, std::memory_order_acquire)) {
+                break;
             }
+        }
+
+        return h;
+    }
+
+  private:
+    alignas(hardware_prefetch_interference_size) std::atomic<clh_node*> head_{};
+    alignas(hardware_prefetch_interference_size) std::atomic<clh_node*> tail_{};
+};
+
+/// Fixed size pool of nodes for a clh_mutex
+template <std::size_t N>
+class clh_node_pool {
+    // Adds 1 to start in the tail, 1 as the queue sentinel, leaving N available
+    // nodes for threads.
+    std::array<clh_node, N + 2> node_storage_{};
+
+    clh_node_queue available_;
+
+  public:
+    clh_node_pool() : available_(node_storage_.begin(), node_storage_.end()) {}
+
+    auto push(clh_node* n) -> void { available_.push(n); }
+    auto try_pop() -> clh_node* { return available_.try_pop(); }
+};
+
+/// Pool of nodes for a clh_mutex, sized at construction
+template <>
+class clh_node_pool<dynamic_extent> {
+    // Set if the nodes are not provided by the caller
+    std::unique_ptr<clh_node[]> node_storage_{};
+
+    clh_node_queue available_;
+
+  public:
+    /// Construct a pool for the number of concurrent threads supported by the
+    /// hardware
+    clh_node_pool() : clh_node_pool(std::max(std::thread::hardware_concurrency(), 1U)) {}
+
+    /// Construct a pool for `threads` threads, allocating nodes once
+    explicit clh_node_pool(std::size_t threads)
+        : node_storage_{std::make_unique<clh_node[]>(threads + 2U)},
+          available_(node_storage_.get(), node_storage_.get() + threads + 2U)
+    {
+        assert(threads != 0U);
+    }
+
+    /// Construct a pool using nodes provided by the caller
+    clh_node_pool(clh_node* first, clh_node* last) : available_(first, last)
+    {
+        assert((last - first) > 2);
+    }
 
-            prev->next = nullptr;
-            tail_.store(prev, std::memory_order_relaxed);
+    auto push(clh_node* n) -> void { available_.push(n); }
+    auto try_pop() -> clh_node* { return available_.try_pop(); }
+};
+
+/// Nodes owned by the calling thread, for queue locks with thread-owned nodes
+///
+/// A thread caches a single node. Additional nodes are created if a thread
+/// waits on multiple locks at once.
+template <class Node>
+class thread_nodes {
+    static auto cache() -> std::unique_ptr<Node>&
+    {
+        thread_local auto node = std::unique_ptr<Node>{};
+        return node;
+    }
+
+  public:
+    /// Takes the node owned by this thread, creating one if necessary
+    static auto try_pop() -> Node*
+    {
+        auto& node = cache();
+        return node ? node.release() : new Node{};
+    }
+
+    /// Gives a node no longer in any queue to this thread
+    static auto push(Node* n) -> void
+    {
+        auto& node = cache();
+        if (node) {
+            // released by a timed out thread, or this thread holds multiple
+            // locks
+            delete n;
+        } else {
+            node.reset(n);
         }
+    }
+};
+
+/// Node pool where threads wait in FIFO order for a node when exhausted
+///
+/// Waiting threads park on the pool, and a released node is handed directly
+/// to the thread that has waited the longest.
+template <class NodePool>
+class clh_waiting_pool {
+    NodePool pool_;
 
-        auto push(node* new_tail) -> void
-        {
-            new_tail->next.store(nullptr, std::memory_order_relaxed);
+    // Number of threads waiting for a node
+    std::atomic_uint waiting_{};
 
-            // No other threads can push without holding the lock.
-            // How strong does the memory order need to be?
-            auto* t = tail_.load(std::memory_order_relaxed);
+  public:
+    template <class... Args>
+    explicit clh_waiting_pool(Args... args) : pool_(args...)
+    {
+        waiting_.store(0U, std::memory_order_relaxed);
+    }
 
-            // Spurious failure is not okay here
-            auto ok = tail_.compare_exchange_strong(
-                t, new_tail, std::memory_order_relaxed, std::memory_order_relaxed);
-            assert(ok);
-            (void)ok;
+    auto push(clh_node* n) -> void
+    {
+        if (waiting_.load(std::memory_order_relaxed) != 0U) {
+            auto handed_off = false;
+            parking_lot::unpark_one(this, [n, &handed_off](auto result) {
+                handed_off = result.unparked;
+                return handed_off ? reinterpret_cast<std::uintptr_t>(n) : std::uintptr_t{};
+            });
+
+            if (handed_off) {
+                return;
+            }
+        }
 
-            // (Q1) update old tail to point to the new tail
-            // synchronizes with (Q3)
-            t->next.store(new_tail, std::memory_order_release);
+        pool_.push(n);
+
+        // A thread may have started waiting after the check above, but
+        // before the node was pushed.
+        // (W1) read-modify-write to load the latest waiting count
+        // synchronizes with (W2)
+        if (waiting_.fetch_add(0U, std::memory_order_acq_rel) != 0U) {
+            parking_lot::unpark_one(this, [this](auto result) {
+                auto* m = result.unparked ? pool_.try_pop() : nullptr;
+                return reinterpret_cast<std::uintptr_t>(m);
+            });
         }
+    }
 
-        auto try_pop() -> node*
-        {
-            // (Q2) grab the head node
-            // synchronizes with (Q4)
-            auto* h = head_.load(std::memory_order_acquire);
+    auto try_pop() -> clh_node* { return pool_.try_pop(); }
 
-            for (;;) {
-                // (Q3) if next is empty, give up
-                // synchronizes with (Q1)
-                auto* next = h->next.load(std::memory_order_acquire);
-                if (next == nullptr) {
-                    return nullptr;
-                }
+    /// Pops a node, waiting until a deadline if none are available
+    template <class Clock, class Duration>
+    auto pop_until(const std::chrono::time_point<Clock, Duration>& deadline) -> clh_node*
+    {
+        auto* n = pool_.try_pop();
+        if (n != nullptr) {
+            return n;
+        }
 
-                // (Q4) update head
-                // synchronizes with (Q2)
-                if (head_.compare_exchange_weak(
-                        h, next, std::memory_order_release, std::memory_order_acquire)) {
-                    break;
+        // (W2) announce waiting before checking the pool again
+        // synchronizes with (W1)
+        waiting_.fetch_add(1U, std::memory_order_acq_rel);
+
+        for (;;) {
+            auto token = std::uintptr_t{};
+            const auto result = parking_lot::park_until(
+                this,
+                [this, &n] {
+                    n = pool_.try_pop();
+                    return n == nullptr;
+                },
+                deadline,
+                &token);
+
+            if (result == parking_lot::park_result::unparked) {
+                n = reinterpret_cast<clh_node*>(token);
+
+                // the node may have been taken by a thread that did not wait
+                if (n == nullptr) {
+                    continue;
                 }
             }
-
-            return h;
+            break;
         }
 
-      private:
-        alignas(hardware_destructive_interference_size) std::atomic<node*> head_{};
-        alignas(hardware_destructive_interference_size) std::atomic<node*> tail_{};
-    };
+        waiting_.fetch_sub(1U, std::memory_order_relaxed);
+        return n;
+    }
+};
 
-    // Pool of nodes for the mutex queue
-    // Adds 1 to start in the tail, 1 as the queue sentinel, leaving N available
-    // nodes for threads.
-    std::array<typename queue::node, N + 2> node_storage_{};
+template <std::size_t N, class Failure>
+using clh_pool_type = std::conditional_t<std::is_same_v<failure::wait, Failure>,
+                                         clh_waiting_pool<clh_node_pool<N>>,
+                                         clh_node_pool<N>>;
 
-    queue available_;
+template <std::size_t N, class Pool, class Failure>
+class clh_pool_base;
 
-    alignas(hardware_destructive_interference_size) std::atomic<typename queue::node*> tail_{};
+template <std::size_t N, class Failure>
+class clh_pool_base<N, pool::local, Failure> {
+    clh_pool_type<N, Failure> pool_;
 
-    // Node granted exclusive access
-    typename queue::node* active_;
+  protected:
+    static constexpr auto is_local = true;
+    static constexpr auto is_shared = false;
+
+    template <class... Args>
+    explicit clh_pool_base(Args... args) : pool_(args...)
+    {}
+
+    auto node_pool() -> clh_pool_type<N, Failure>& { return pool_; }
+};
+
+template <std::size_t N, class Group, class Failure>
+class clh_pool_base<N, pool::shared<Group>, Failure> {
+  protected:
+    static constexpr auto is_local = false;
+    static constexpr auto is_shared = true;
+
+    static auto node_pool() -> clh_pool_type<N, Failure>&
+    {
+        static auto pool = clh_pool_type<N, Failure>{};
+        return pool;
+    }
+};
+
+template <std::size_t N, class Failure>
+class clh_pool_base<N, pool::thread_owned, Failure> {
+  protected:
+    static constexpr auto is_local = false;
+    static constexpr auto is_shared = false;
+
+    static auto node_pool() -> thread_nodes<clh_node> { return {}; }
+};
 
+template <class Depth>
+class clh_depth;
+
+template <>
+class clh_depth<depth::counted> {
     // Number of times a node has been acquired (thread has queued for the lock)
     std::atomic_uint queue_count_{};
 
   public:
-    clh_mutex() : available_(node_storage_.begin(), node_storage_.end())
+    clh_depth() { queue_count_.store(0, std::memory_order_relaxed); }
+
+    static auto number(clh_node*, const clh_node*) -> void {}
+
+    auto enqueued() -> void
     {
-        queue_count_.store(0, std::memory_order_relaxed);
+        // (X1) increase queued count
+        // synchronizes with (X3)
+        queue_count_.fetch_add(1, std::memory_order_release);
+    }
 
-        auto* n = available_.try_pop();
-        assert(n != nullptr);
+    static auto acquired(const clh_node*) -> void {}
 
-        n->locked.store(false, std::memory_order_relaxed);
-        tail_.store(n, std::memory_order_relaxed);
+    auto left() -> void
+    {
+        // (X2) decrease queued count
+        // synchronizes with (X3)
+        queue_count_.fetch_sub(1, std::memory_order_release);
     }
 
-    ~clh_mutex() = default;
+    [[nodiscard]] auto count(const std::atomic<clh_node*>&) const -> unsigned int
+    {
+        // (X3) load queue count
+        // synchronizes with (X1), (X2)
+        return queue_count_.load(std::memory_order_acquire);
+    }
+};
 
-    clh_mutex(const clh_mutex&) = delete;
-    clh_mutex(clh_mutex&&) = delete;
-    auto operator=(const clh_mutex&) -> clh_mutex& = delete;
-    auto operator=(clh_mutex&&) -> clh_mutex& = delete;
+template <>
+class clh_depth<depth::ticketed> {
+    // Ticket of the node granted exclusive access. Only written by the holder.
+    std::atomic_size_t served_{};
 
-    auto lock()
+  public:
+    clh_depth() { served_.store(0U, std::memory_order_relaxed); }
+
+    /// Numbers a node before it is swapped with the queue tail
+    static auto number(clh_node* n, const clh_node* pred) -> void
     {
-        static constexpr auto years = std::chrono::hours{24 * 365};
-        assert(try_lock_for(10 * years));
-        (void)years;
+        n->ticket.store(pred->ticket.load(std::memory_order_relaxed) + 1U,
+                        std::memory_order_relaxed);
     }
 
-    auto try_lock() -> bool { return try_lock_for(std::chrono::seconds{0}); }
+    static auto enqueued() -> void {}
 
-    template <class Rep, class Period>
-    auto try_lock_for(const std::chrono::duration<Rep, Period>& duration) -> bool
+    auto acquired(const clh_node* n) -> void
     {
-        return try_lock_until(std::chrono::steady_clock::now() + duration);
+        served_.store(n->ticket.load(std::memory_order_relaxed), std::memory_order_relaxed);
     }
 
-    template <class Clock, class Duration>
-    auto try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline) -> bool
+    static auto left() -> void {}
+
+    /// Includes abandonned nodes that have not yet been skipped over
+    [[nodiscard]] auto count(const std::atomic<clh_node*>& tail) const -> unsigned int
     {
-        auto* n = try_pop_node_until(deadline);
-        if (n == nullptr) {
-            return false;
+        const auto served = served_.load(std::memory_order_relaxed);
+
+        // nodes are not freed while the mutex exists, but the tail may be
+        // recycled after it is loaded
+        const auto* t = tail.load(std::memory_order_acquire);
+        if (!t->locked.load(std::memory_order_acquire)) {
+            return 0U;
         }
 
-        // signal intent to acquire lock
-        n->locked.store(true, std::memory_order_relaxed);
+        const auto ticket = t->ticket.load(std::memory_order_relaxed);
+        return (ticket < served) ? 0U : static_cast<unsigned int>(ticket - served + 1U);
+    }
+};
 
-        // (C1) grab predecessor
-        // synchronizes with (C2)
-        auto* pred = tail_.load(std::memory_order_acquire);
+}  // namespace detail
 
-        // (C2) swap predecessor with self, becoming the predecessor for the
-        // next thread
-        // synchronizes with (C1)
-        while (!tail_.compare_exchange_weak(
-            pred, n, std::memory_order_release, std::memory_order_acquire)) {
-            if (Clock::now() >= deadline) {
-                return false;
-            }
-        }
+/// @brief Mutex implementing a CLH Queue Lock
+///
+/// @tparam N Number of nodes in the fixed sized pool. Should match the number
+///     of concurrent threads accessing the lock. Additional nodes may be used
+///     for bookkeeping. If `dynamic_extent`, the pool is sized when
+///     constructed.
+/// @tparam Failure Policy when failing to obtain a node on calling lock. Must
+///     be `failure::retry`, `failure::die`, or `failure::wait`.
+/// @tparam Pool Storage of the node pool. Must be `pool::local`,
+///     `pool::shared<Group>`, or `pool::thread_owned`.
+/// @tparam Depth Queue depth tracking for `queue_count`. Must be
+///     `depth::counted` or `depth::ticketed`.
+///
+/// Implements a mutex similar to CLH queue lock. This class manages a
+/// fixed-size pool of nodes instead of threads allocating a node when locking.
+/// A node will be recycled to the available pool of nodes after a thread
+/// unlocks.
+///
+/// With `failure::wait`, threads park while the pool is exhausted and are handed
+/// released nodes in FIFO order, instead of repeatedly polling the pool.
+///
+/// With `pool::shared`, nodes are drawn from a pool shared by many mutexes with
+/// the same `N`, `Failure` and `Group`. `N` should match the number of threads
+/// accessing any of them. A node is
+/// returned to the pool on unlock if there are no waiters, so that an unlocked
+/// mutex does not hold onto any nodes.
+///
+/// With `pool::thread_owned`, the number of threads is not limited and locking
+/// never fails to obtain a node. A thread that times out leaves its node in the
+/// queue and creates a new one on its next attempt.
+///
+/// With `depth::ticketed`, locking and unlocking do not update a shared queue
+/// count. Instead, `queue_count` derives the queue depth from node tickets,
+/// which is more expensive to call. Not supported with `pool::thread_owned`
+/// as nodes may be freed while inspected.
+///
+/// With `failure::retry`, `pool::local` and `depth::counted`, an `N` of 1 or 2
+/// selects a specialization without a node pool. The queue depth is derived
+/// from the lock word, so `queue_count` is at most 2. With `depth::ticketed`,
+/// the node queue is used and every waiting thread is counted.
+///
+/// @note Implements TimedMutex
+template <std::size_t N,
+          class Failure = failure::retry,
+          class Pool = pool::local,
+          class Depth = depth::counted>
+class clh_mutex : detail::clh_pool_base<N, Pool, Failure> {
+    static_assert(N > 0, "Number of nodes must be greater than 0.");
 
-        // (X1) increase queued count
-        // synchronizes with (X4)
-        queue_count_.fetch_add(1, std::memory_order_release);
+    static_assert(std::disjunction_v<std::is_same<failure::retry, Failure>,
+                                     std::is_same<failure::die, Failure>,
+                                     std::is_same<failure::wait, Failure>>);
 
-        for (;;) {
-            // (C3) spin on predecessor until the lock is released
-            // synchronizes with (C4),(C5)
-            while (pred->locked.load(std::memory_order_acquire)) {
-                if (Clock::now() >= deadline) {
-                    // propagate the predecessor to denote abandonment
-                    n->pred = pred;
-
-                    // (X2) decrease queued count
-                    // synchronizes with (X4)
-                    queue_count_.fetch_sub(1, std::memory_order_release);
-
-                    // (C4) release lock
-                    // synchronizes with (C3)
-                    n->locked.store(false, std::memory_order_release);
-                    return false;
-                }
-            }
+    static_assert(std::disjunction_v<std::is_same<depth::counted, Depth>,
+                                     std::is_same<depth::ticketed, Depth>>);
 
-            // save pred's pred in case it needs to be waited upon
-            auto* abandonned = pred->pred;
+    static_assert(!(std::is_same_v<depth::ticketed, Depth> &&
+                    std::is_same_v<pool::thread_owned, Pool>),
+                  "Ticketed queue depth requires nodes that outlive the mutex.");
 
-            // recycle the predecessor node
-            available_.push(pred);
+    using node = detail::clh_node;
+    using base = detail::clh_pool_base<N, Pool, Failure>;
+    using base::is_local;
+    using base::is_shared;
+    using base::node_pool;
 
-            // check if pred was abandonned due to timeout
-            if (abandonned) {
-                pred = abandonned;
-            } else {
-                break;
-            }
-        }
+    // The tail is not padded when nodes are not stored in the mutex, keeping
+    // the mutex small
+    static constexpr auto tail_alignment =
+        is_local ? hardware_destructive_interference_size : alignof(std::atomic<node*>);
 
-        active_ = n;
-        return true;
-    }
+    alignas(tail_alignment) std::atomic<node*> tail_{};
 
-    auto unlock()
-    {
-        // clear the predecessor, no timeout here
-        active_->pred = nullptr;
+    // Node granted exclusive access
+    node* active_;
 
-        // (X3) decrease queued count
-        // synchronizes with (X4)
-        queue_count_.fetch_sub(1, std::memory_order_release);
+    detail::clh_depth<Depth> depth_{};
 
-        // (C5) release lock
-        // synchronizes with (C3)
-        active_->locked.store(false, std::memory_order_release);
+    static constexpr auto is_dynamic = (N == dynamic_extent) && is_local;
+
+  public:
+    /// Node type, for providing storage to a mutex with a runtime-sized pool
+    using node_type = node;
+
+    /// @brief Number of nodes needed for a runtime-sized pool
+    /// @param threads Number of concurrent threads accessing the lock
+    static constexpr auto nodes_required(std::size_t threads) -> std::size_t
+    {
+        return threads + 2U;
     }
 
-    // Current number of threads waiting on (also includes owning) the lock
-    // NOTE: May be inaccurate due to racing but can provide some barrier-like
-    //     functionality.
-    [[nodiscard]] auto queue_count() const -> unsigned int
+    /// @brief Constructs a mutex
+    ///
+    /// If the pool is runtime-sized, it is sized for the number of concurrent
+    /// threads supported by the hardware.
+    clh_mutex() { init(); }
+
+    /// @brief Constructs a mutex with a runtime-sized pool
+    /// @param threads Number of concurrent threads accessing the lock
+    ///
+    /// Nodes are allocated once on construction.
+    template <bool Dynamic = is_dynamic, std::enable_if_t<Dynamic, bool> = true>
+    explicit clh_mutex(std::size_t threads) : base(threads)
     {
-        // (X4) load queue count
-        // synchronizes with (X1), (X2), (X3)
-        return queue_count_.load(std::memory_order_acquire);
+        init();
     }
 
-  private:
-    template <class Clock, class Duration>
-    auto try_pop_node_until(const std::chrono::time_point<Clock, Duration>& deadline)
+    /// @brief Constructs a mutex with a runtime-sized pool
+    /// @param first, last Range of nodes used by the pool, with size
+    ///     `nodes_required(threads)`. Must outlive the mutex.
+    template <bool Dynamic = is_dynamic, std::enable_if_t<Dynamic, bool> = true>
+    clh_mutex(node_type* first, node_type* last) : base(first, last)
     {
-        auto* n = available_.try_pop();
+        init();
+    }
 
-        while ((n == nullptr) && (Clock::now() < deadline)) {
-            // This can fail due to ABA - if after popping the head, but before
-            // loading head->next, the entire queue gets popped/pushed by other
-            // threads.
-            // This could be resolved by DCAS but there are no standard library
-            // functions to use that and requires more implementation work.
-            if (std::is_same_v<failure::die, Failure>) {
-                throw error_on_slots_exceeded();
+    ~clh_mutex()
+    {
+        if constexpr (!is_local) {
+            // return the released node, and any nodes abandoned after it
+            for (auto* n = tail_.load(std::memory_order_acquire);
+                 n != detail::unlocked_clh_node();) {
+                auto* pred = n->pred.load(std::memory_order_relaxed);
+                node_pool().push(n);
+
+                if (pred == nullptr) {
+                    break;
+                }
+                n = pred;
             }
-            n = available_.try_pop();
         }
+    }
 
-        return n;
+    clh_mutex(const clh_mutex&) = delete;
+    clh_mutex(clh_mutex&&) = delete;
+    auto operator=(const clh_mutex&) -> clh_mutex& = delete;
+    auto operator=(clh_mutex&&) -> clh_mutex& = delete;
+
+    auto lock()
+    {
+        static constexpr auto years = std::chrono::hours{24 * 365};
+        while (!try_lock_for(10 * years)) {}
     }
-};
+
+    /// @brief Attempts to lock the mutex without waiting
+    ///
+    /// Inspects the queue tail first, returning `false` without joining the
+    /// queue if the lock is held or has waiters. Otherwise, joins the queue
+    /// with a single CAS. If the tail has been abandonned, the queue is joined
+    /// as with `try_lock_for` to determine whether the lock is held.
+    ///
+    /// With `pool::thread_owned`, the tail node may be freed by its owner
+    /// once it has a successor, so the queue is always joined as with
+    /// `try_lock_for` and only nodes owned by the queue are inspected.
+    auto try_lock() -> bool
+    {
+        if constexpr (std::is_same_v<pool::thread_owned, Pool>) {
+            return try_lock_for(std::chrono::seconds{0});
+        }
+
+        // (C1) grab predecessor
+        // synchronizes with (C2), (C6)
+        auto* pred = tail_.load(std::memory_order_acquire);
+
+        // (C3) check if the lock is held or has waiters
+        // synchronizes with (C4), (C5)
+        if (pred->locked.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        // abandonned nodes must be walked to determine if the lock is held
+        if (pred->pred.load(std::memory_order_relaxed) != nullptr) {
+            return try_lock_for(std::chrono::seconds{0});
+        }
+
+        auto* n = node_pool().try_pop();
+        if (n == nullptr) {
+            return false;
+        }
+
+        n->locked.store(true, std::memory_order_relaxed);
+        depth_.number(n, pred);
+
+        // (C2) swap predecessor with self
+        // synchronizes with (C1), (C6)
+        if (!tail_.compare_exchange_strong(
+                pred, n, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            node_pool().push(n);
+            return false;
+        }
+
+        depth_.enqueued();
+
+        auto w = waiter{};
+        w.node_ = n;
+        w.pred_ = pred;
+
+        if (poll(w)) {
+            return true;
+        }
+
+        // the predecessor was recycled and queued again after it was inspected
+        abandon(w);
+        return false;
+    }
+
+    template <class Rep, class Period>
+    auto try_lock_for(const std::chrono::duration<Rep, Period>& duration) -> bool
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    template <class Clock, class Duration>
+    auto try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline) -> bool
+    {
+        auto ec = std::error_code{};
+        const auto locked = try_lock_until(deadline, ec);
+        if (ec) {
+            detail::raise(ec);
+        }
+        return locked;
+    }
+
+    /// @brief Attempts to lock the mutex without throwing
+    /// @param ec Set to `slots_exceeded_error()` if a node could not be
+    ///     obtained with `failure::die`, otherwise cleared
+    template <class Rep, class Period>
+    auto try_lock_for(const std::chrono::duration<Rep, Period>& duration, std::error_code& ec)
+        -> bool
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration, ec);
+    }
+
+    /// @copydoc try_lock_for(const std::chrono::duration<Rep, Period>&, std::error_code&)
+    template <class Clock, class Duration>
+    auto try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline,
+                        std::error_code& ec) -> bool
+    {
+        auto w = enqueue_until(deadline, ec);
+        if (!w) {
+            return false;
+        }
+
+        while (!poll(w)) {
+            if (Clock::now() >= deadline) {
+                abandon(w);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// @brief A thread queued on the lock
+    ///
+    /// Obtained from `enqueue_until`. A valid waiter must either acquire the
+    /// lock with `poll` or leave the queue with `abandon`.
+    class waiter {
+        node* node_{};
+        node* pred_{};
+
+        friend class clh_mutex;
+
+      public:
+        /// @brief Checks whether `*this` is queued on the lock
+        [[nodiscard]] explicit operator bool() const noexcept { return node_ != nullptr; }
+    };
+
+    /// @brief Join the lock queue without waiting for the lock
+    /// @return A waiter, which is invalid if a node could not be obtained
+    ///     before the deadline
+    ///
+    /// Allows a thread to wait on multiple locks at the same time.
+    template <class Clock, class Duration>
+    auto enqueue_until(const std::chrono::time_point<Clock, Duration>& deadline) -> waiter
+    {
+        auto ec = std::error_code{};
+        auto w = enqueue_until(deadline, ec);
+        if (ec) {
+            detail::raise(ec);
+        }
+        return w;
+    }
+
+    /// @brief Join the lock queue without waiting for the lock or throwing
+    /// @param ec Set to `slots_exceeded_error()` if a node could not be
+    ///     obtained with `failure::die`, otherwise cleared
+    template <class Clock, class Duration>
+    auto enqueue_until(const std::chrono::time_point<Clock, Duration>& deadline,
+                       std::error_code& ec) -> waiter
+    {
+        ec.clear();
+
+        auto* n = try_pop_node_until(deadline, ec);
+        if (n == nullptr) {
+            return {};
+        }
+
+        // signal intent to acquire lock
+        n->locked.store(true, std::memory_order_relaxed);
+
+        // (C1) grab predecessor
+        // synchronizes with (C2)
+        auto* pred = tail_.load(std::memory_order_acquire);
+        depth_.number(n, pred);
+
+        // (C2) swap predecessor with self, becoming the predecessor for the
+        // next thread
+        // synchronizes with (C1), (C6), (C7)
+        while (!tail_.compare_exchange_weak(
+            pred, n, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            if (Clock::now() >= deadline) {
+                node_pool().push(n);
+                return {};
+            }
+            depth_.number(n, pred);
+        }
+
+        depth_.enqueued();
+
+        auto w = waiter{};
+        w.node_ = n;
+        w.pred_ = pred;
+        return w;
+    }
+
+    /// @brief Check if a waiter has been granted the lock, without blocking
+    /// @param w A valid waiter
+    /// @return `true` if the lock is acquired, after which `w` is invalid
+    auto poll(waiter& w) -> bool
+    {
+        assert(w);
+
+        for (;;) {
+            // (C3) check if the predecessor has released the lock
+            // synchronizes with (C4),(C5)
+            if (w.pred_->locked.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            // save pred's pred in case it needs to be waited upon
+            auto* abandonned = w.pred_->pred.load(std::memory_order_relaxed);
+
+            // recycle the predecessor node
+            if (w.pred_ != detail::unlocked_clh_node()) {
+                node_pool().push(w.pred_);
+            }
+
+            // check if pred was abandonned due to timeout
+            if (abandonned) {
+                w.pred_ = abandonned;
+            } else {
+                break;
+            }
+        }
+
+        active_ = w.node_;
+        depth_.acquired(active_);
+        w = {};
+        return true;
+    }
+
+    /// @brief Leave the lock queue
+    /// @param w A valid waiter, which is invalid afterwards
+    ///
+    /// Predecessors that have already been abandonned are reclaimed. If `w` is
+    /// the queue tail, it is spliced out of the queue and its node is
+    /// reclaimed immediately. Otherwise, the node is left in the queue and is
+    /// reclaimed by the successor, which must skip over it when acquiring the
+    /// lock.
+    auto abandon(waiter& w) -> void
+    {
+        assert(w);
+
+        for (;;) {
+            // (C3) check if the predecessor has left the queue
+            // synchronizes with (C4),(C5)
+            if (w.pred_->locked.load(std::memory_order_acquire)) {
+                break;
+            }
+
+            auto* abandonned = w.pred_->pred.load(std::memory_order_relaxed);
+            if (abandonned == nullptr) {
+                break;
+            }
+
+            node_pool().push(w.pred_);
+            w.pred_ = abandonned;
+        }
+
+        depth_.left();
+
+        // (C7) splice self out of the queue. Without a successor, no other
+        // thread can reference the node.
+        // synchronizes with (C2), (C7)
+        auto* n = w.node_;
+        if (tail_.compare_exchange_strong(
+                n, w.pred_, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            node_pool().push(w.node_);
+            w = {};
+            return;
+        }
+
+        // propagate the predecessor to denote abandonment
+        w.node_->pred.store(w.pred_, std::memory_order_relaxed);
+
+        // (C4) release lock
+        // synchronizes with (C3)
+        w.node_->locked.store(false, std::memory_order_release);
+        w = {};
+    }
+
+    auto unlock()
+    {
+        // clear the predecessor, no timeout here
+        active_->pred.store(nullptr, std::memory_order_relaxed);
+
+        depth_.left();
+
+        if constexpr (is_shared) {
+            auto* const released = active_;
+            auto* n = released;
+
+            // (C6) release lock if there are no waiters
+            // synchronizes with (C1), (C2)
+            if (tail_.compare_exchange_strong(n,
+                                              detail::unlocked_clh_node(),
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed)) {
+                // `active_` may already be written by the next lock holder
+                node_pool().push(released);
+                return;
+            }
+        }
+
+        // (C5) release lock
+        // synchronizes with (C3)
+        active_->locked.store(false, std::memory_order_release);
+    }
+
+    /// @brief Checks whether another thread has queued since the lock was acquired
+    /// @pre The lock is held by the calling thread
+    ///
+    /// Only reads the queue tail, allowing a lock holder to poll cheaply for
+    /// waiters.
+    [[nodiscard]] auto contended() const -> bool
+    {
+        return tail_.load(std::memory_order_relaxed) != active_;
+    }
+
+    // Current number of threads waiting on (also includes owning) the lock.
+    // The specializations for an `N` of 1 or 2 count at most one waiter.
+    // NOTE: May be inaccurate due to racing but can provide some barrier-like
+    //     functionality.
+    [[nodiscard]] auto queue_count() const -> unsigned int { return depth_.count(tail_); }
+
+  private:
+    auto init() -> void
+    {
+        if constexpr (!is_local) {
+            tail_.store(detail::unlocked_clh_node(), std::memory_order_relaxed);
+        } else {
+            auto* n = node_pool().try_pop();
+            assert(n != nullptr);
+
+            n->locked.store(false, std::memory_order_relaxed);
+            tail_.store(n, std::memory_order_relaxed);
+        }
+    }
+
+    template <class Clock, class Duration>
+    auto try_pop_node_until(const std::chrono::time_point<Clock, Duration>& deadline,
+                            std::error_code& ec)
+    {
+        // thread-owned nodes are always available
+        if constexpr (std::is_same_v<failure::wait, Failure> && (is_local || is_shared)) {
+            return node_pool().pop_until(deadline);
+        } else {
+            return try_pop_node_spin_until(deadline, ec);
+        }
+    }
+
+    template <class Clock, class Duration>
+    auto try_pop_node_spin_until(const std::chrono::time_point<Clock, Duration>& deadline,
+                                 std::error_code& ec)
+    {
+        auto* n = node_pool().try_pop();
+
+        while ((n == nullptr) && (Clock::now() < deadline)) {
+            // This can fail due to ABA - if after popping the head, but before
+            // loading head->next, the entire queue gets popped/pushed by other
+            // threads.
+            // This could be resolved by DCAS but there are no standard library
+            // functions to use that and requires more implementation work.
+            if (std::is_same_v<failure::die, Failure>) {
+                ec = slots_exceeded_error();
+                break;
+            }
+            n = node_pool().try_pop();
+        }
+
+        return n;
+    }
+};
+
+/// @brief Mutex for a single thread, implemented as a timed spinlock
+///
+/// With one node, at most one thread is expected to contend for the lock, so
+/// there is no queue to maintain. Threads spin on a lock word, setting a
+/// waiting bit while the lock is held. The waiter API is kept, so that
+/// `access_any` and lease checks work as with other pool sizes, but waiters
+/// are not granted the lock in order.
+///
+/// @note Implements TimedMutex
+template <>
+class clh_mutex<1, failure::retry, pool::local, depth::counted> {
+    static constexpr std::uint8_t locked = 1U;
+    static constexpr std::uint8_t waiting = 2U;
+
+    alignas(hardware_destructive_interference_size) std::atomic<std::uint8_t> state_{};
+
+    auto try_acquire() -> bool
+    {
+        auto s = std::uint8_t{};
+
+        // (S1) acquire the lock word
+        // synchronizes with (S2)
+        return (state_.load(std::memory_order_relaxed) == 0U) &&
+               state_.compare_exchange_strong(
+                   s, locked, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    auto mark_waiting() -> void
+    {
+        auto s = locked;
+        state_.compare_exchange_strong(s,
+                                       static_cast<std::uint8_t>(locked | waiting),
+                                       std::memory_order_relaxed,
+                                       std::memory_order_relaxed);
+    }
+
+    // Clears the waiting bit while the lock is held
+    auto clear_waiting() -> void
+    {
+        auto s = static_cast<std::uint8_t>(locked | waiting);
+        state_.compare_exchange_strong(
+            s, locked, std::memory_order_relaxed, std::memory_order_relaxed);
+    }
+
+  public:
+    clh_mutex() { state_.store(0U, std::memory_order_relaxed); }
+
+    ~clh_mutex() = default;
+
+    clh_mutex(const clh_mutex&) = delete;
+    clh_mutex(clh_mutex&&) = delete;
+    auto operator=(const clh_mutex&) -> clh_mutex& = delete;
+    auto operator=(clh_mutex&&) -> clh_mutex& = delete;
+
+    auto lock() -> void
+    {
+        while (!try_acquire()) {
+            mark_waiting();
+            detail::cpu_relax();
+        }
+    }
+
+    auto try_lock() -> bool { return try_acquire(); }
+
+    template <class Rep, class Period>
+    auto try_lock_for(const std::chrono::duration<Rep, Period>& duration) -> bool
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    template <class Clock, class Duration>
+    auto try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline) -> bool
+    {
+        while (!try_acquire()) {
+            if (Clock::now() >= deadline) {
+                clear_waiting();
+                return false;
+            }
+            mark_waiting();
+            detail::cpu_relax();
+        }
+        return true;
+    }
+
+    /// @brief Attempts to lock the mutex without throwing
+    /// @param ec Always cleared, as no node is needed
+    template <class Rep, class Period>
+    auto try_lock_for(const std::chrono::duration<Rep, Period>& duration, std::error_code& ec)
+        -> bool
+    {
+        ec.clear();
+        return try_lock_for(duration);
+    }
+
+    /// @copydoc try_lock_for(const std::chrono::duration<Rep, Period>&, std::error_code&)
+    template <class Clock, class Duration>
+    auto try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline,
+                        std::error_code& ec) -> bool
+    {
+        ec.clear();
+        return try_lock_until(deadline);
+    }
+
+    auto unlock() -> void
+    {
+        // (S2) release the lock word
+        // synchronizes with (S1)
+        state_.store(0U, std::memory_order_release);
+    }
+
+    /// @brief A thread waiting on the lock
+    ///
+    /// Obtained from `enqueue_until`. Valid until the lock is acquired with
+    /// `poll` or the waiter is passed to `abandon`.
+    class waiter {
+        std::uint8_t state_{};
+
+        friend class clh_mutex;
+
+      public:
+        /// @brief Checks whether `*this` is waiting on the lock
+        [[nodiscard]] explicit operator bool() const noexcept { return state_ != 0U; }
+    };
+
+    /// @brief Start waiting on the lock without blocking
+    /// @return A valid waiter, which may already hold the lock
+    template <class Clock, class Duration>
+    auto enqueue_until(const std::chrono::time_point<Clock, Duration>&) -> waiter
+    {
+        auto w = waiter{};
+
+        if (try_acquire()) {
+            w.state_ = locked;
+        } else {
+            mark_waiting();
+            w.state_ = waiting;
+        }
+
+        return w;
+    }
+
+    /// @copydoc enqueue_until(const std::chrono::time_point<Clock, Duration>&)
+    /// @param ec Always cleared, as no node is needed
+    template <class Clock, class Duration>
+    auto enqueue_until(const std::chrono::time_point<Clock, Duration>& deadline,
+                       std::error_code& ec) -> waiter
+    {
+        ec.clear();
+        return enqueue_until(deadline);
+    }
+
+    /// @brief Check if a waiter has acquired the lock, without blocking
+    /// @param w A valid waiter
+    /// @return `true` if the lock is acquired, after which `w` is invalid
+    auto poll(waiter& w) -> bool
+    {
+        assert(w);
+
+        if ((w.state_ == locked) || try_acquire()) {
+            w = {};
+            return true;
+        }
+
+        mark_waiting();
+        return false;
+    }
+
+    /// @brief Stop waiting on the lock
+    /// @param w A valid waiter, which is invalid afterwards
+    ///
+    /// The waiting bit is cleared, as other waiters set it again when they
+    /// next check the lock.
+    auto abandon(waiter& w) -> void
+    {
+        assert(w);
+
+        if (w.state_ == locked) {
+            unlock();
+        } else {
+            clear_waiting();
+        }
+
+        w = {};
+    }
+
+    /// @brief Checks whether another thread has waited since the lock was acquired
+    /// @pre The lock is held by the calling thread
+    [[nodiscard]] auto contended() const -> bool
+    {
+        return (state_.load(std::memory_order_relaxed) & waiting) != 0U;
+    }
+
+    // Current number of threads waiting on (also includes owning) the lock.
+    // Any number of waiting threads is counted as one.
+    // NOTE: May be inaccurate due to racing
+    [[nodiscard]] auto queue_count() const -> unsigned int
+    {
+        const auto s = state_.load(std::memory_order_relaxed);
+        return ((s & locked) != 0U) ? (((s & waiting) != 0U) ? 2U : 1U) : 0U;
+    }
+};
+
+/// @brief Mutex for two threads, implemented as a handoff between a holder and
+///     a single waiter
+///
+/// A lock word records whether the lock is held and whether a thread waits
+/// for it. On unlock, the lock is passed directly to the waiter, so that locks
+/// are granted in FIFO order. As with a single available node, a further
+/// thread is pending until it can become the waiter.
+///
+/// @note Implements TimedMutex
+template <>
+class clh_mutex<2, failure::retry, pool::local, depth::counted> {
+    static constexpr std::uint8_t unlocked = 0U;
+    static constexpr std::uint8_t locked = 1U;
+    static constexpr std::uint8_t queued = 2U;
+    static constexpr std::uint8_t passed = 3U;
+
+    // Waiter state, not stored in the lock word
+    static constexpr std::uint8_t pending = 4U;
+
+    alignas(hardware_destructive_interference_size) std::atomic<std::uint8_t> state_{};
+
+  public:
+    clh_mutex() { state_.store(unlocked, std::memory_order_relaxed); }
+
+    ~clh_mutex() = default;
+
+    clh_mutex(const clh_mutex&) = delete;
+    clh_mutex(clh_mutex&&) = delete;
+    auto operator=(const clh_mutex&) -> clh_mutex& = delete;
+    auto operator=(clh_mutex&&) -> clh_mutex& = delete;
+
+    auto lock() -> void { try_lock_until(std::chrono::steady_clock::time_point::max()); }
+
+    auto try_lock() -> bool
+    {
+        auto s = unlocked;
+
+        // (H1) acquire the lock word
+        // synchronizes with (H3)
+        return (state_.load(std::memory_order_relaxed) == unlocked) &&
+               state_.compare_exchange_strong(
+                   s, locked, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    template <class Rep, class Period>
+    auto try_lock_for(const std::chrono::duration<Rep, Period>& duration) -> bool
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    template <class Clock, class Duration>
+    auto try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline) -> bool
+    {
+        auto w = enqueue_until(deadline);
+        if (!w) {
+            return false;
+        }
+
+        while (!poll(w)) {
+            if (Clock::now() >= deadline) {
+                abandon(w);
+                return false;
+            }
+            detail::cpu_relax();
+        }
+
+        return true;
+    }
+
+    /// @brief Attempts to lock the mutex without throwing
+    /// @param ec Always cleared, as no node is needed
+    template <class Rep, class Period>
+    auto try_lock_for(const std::chrono::duration<Rep, Period>& duration, std::error_code& ec)
+        -> bool
+    {
+        ec.clear();
+        return try_lock_for(duration);
+    }
+
+    /// @copydoc try_lock_for(const std::chrono::duration<Rep, Period>&, std::error_code&)
+    template <class Clock, class Duration>
+    auto try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline,
+                        std::error_code& ec) -> bool
+    {
+        ec.clear();
+        return try_lock_until(deadline);
+    }
+
+    /// @brief A thread's position in the lock queue
+    ///
+    /// Obtained from `enqueue_until`. Valid until the lock is acquired with
+    /// `poll` or the waiter is passed to `abandon`.
+    class waiter {
+        std::uint8_t state_{};
+
+        friend class clh_mutex;
+
+      public:
+        /// @brief Checks whether `*this` is queued on the lock
+        [[nodiscard]] explicit operator bool() const noexcept { return state_ != unlocked; }
+    };
+
+  private:
+    // Attempts to acquire the lock word, or otherwise to become the waiter
+    auto join(waiter& w) -> void
+    {
+        auto s = state_.load(std::memory_order_relaxed);
+
+        // (H1) acquire the lock word
+        // synchronizes with (H3)
+        if ((s == unlocked) &&
+            state_.compare_exchange_strong(
+                s, locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+            w.state_ = locked;
+            return;
+        }
+
+        if ((s == locked) &&
+            state_.compare_exchange_strong(
+                s, queued, std::memory_order_relaxed, std::memory_order_relaxed)) {
+            w.state_ = queued;
+        }
+    }
+
+  public:
+    /// @brief Join the lock queue without waiting for the lock
+    /// @return A valid waiter. If another thread is already waiting, the
+    ///     waiter is pending and joins the queue when polled.
+    template <class Clock, class Duration>
+    auto enqueue_until(const std::chrono::time_point<Clock, Duration>&) -> waiter
+    {
+        auto w = waiter{};
+        w.state_ = pending;
+
+        join(w);
+        return w;
+    }
+
+    /// @copydoc enqueue_until(const std::chrono::time_point<Clock, Duration>&)
+    /// @param ec Always cleared, as no node is needed
+    template <class Clock, class Duration>
+    auto enqueue_until(const std::chrono::time_point<Clock, Duration>& deadline,
+                       std::error_code& ec) -> waiter
+    {
+        ec.clear();
+        return enqueue_until(deadline);
+    }
+
+    /// @brief Check if a waiter has been granted the lock, without blocking
+    /// @param w A valid waiter
+    /// @return `true` if the lock is acquired, after which `w` is invalid
+    auto poll(waiter& w) -> bool
+    {
+        assert(w);
+
+        if (w.state_ == pending) {
+            join(w);
+            if (w.state_ != locked) {
+                return false;
+            }
+        }
+
+        if (w.state_ == queued) {
+            // (H2) check if the lock has been passed
+            // synchronizes with (H3)
+            if (state_.load(std::memory_order_acquire) != passed) {
+                return false;
+            }
+
+            // No other thread modifies the lock word after it is passed
+            state_.store(locked, std::memory_order_relaxed);
+        }
+
+        w = {};
+        return true;
+    }
+
+    /// @brief Leave the lock queue
+    /// @param w A valid waiter, which is invalid afterwards
+    auto abandon(waiter& w) -> void
+    {
+        assert(w);
+
+        if (w.state_ == pending) {
+            w = {};
+            return;
+        }
+
+        auto s = queued;
+        if ((w.state_ == locked) ||
+            !state_.compare_exchange_strong(
+                s, locked, std::memory_order_relaxed, std::memory_order_relaxed)) {
+            // the lock was granted before leaving the queue
+            poll(w);
+            unlock();
+        }
+
+        w = {};
+    }
+
+    auto unlock() -> void
+    {
+        auto s = state_.load(std::memory_order_relaxed);
+
+        // (H3) release the lock word, passing it to the waiter if there is one
+        // synchronizes with (H1), (H2)
+        while (!state_.compare_exchange_weak(s,
+                                             (s == queued) ? passed : unlocked,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed)) {}
+    }
+
+    /// @brief Checks whether another thread has queued since the lock was acquired
+    /// @pre The lock is held by the calling thread
+    [[nodiscard]] auto contended() const -> bool
+    {
+        return state_.load(std::memory_order_relaxed) == queued;
+    }
+
+    // Current number of threads waiting on (also includes owning) the lock.
+    // A pending thread is not counted until it becomes the waiter.
+    // NOTE: May be inaccurate due to racing but can provide some barrier-like
+    //     functionality.
+    [[nodiscard]] auto queue_count() const -> unsigned int
+    {
+        const auto s = state_.load(std::memory_order_relaxed);
+        return (s == passed) ? 1U : s;
+    }
+};
+
+template <std::size_t N, class Failure, class Pool, class Depth>
+struct is_transferable<clh_mutex<N, Failure, Pool, Depth>> : std::true_type {};
+
+namespace detail {
+
+/// @brief Node pool a mutex shares with other mutexes, if any
+template <class Mutex>
+struct shared_node_pool {
+    using type = void;
+    static constexpr auto size = std::size_t{};
+};
+
+template <std::size_t N, class Failure, class Group, class Depth>
+struct shared_node_pool<clh_mutex<N, Failure, pool::shared<Group>, Depth>> {
+    using type = clh_pool_base<N, pool::shared<Group>, Failure>;
+    static constexpr auto size = N;
+};
+
+/// Number of `Mutexes` that draw nodes from the same pool as `Mutex`
+template <class Mutex, class... Mutexes>
+inline constexpr auto shared_node_count_v =
+    (std::size_t{std::is_same_v<typename shared_node_pool<Mutex>::type,
+                                typename shared_node_pool<Mutexes>::type>} +
+     ...);
+
+/// Checks that every shared node pool has a node for each of `Mutexes`, if
+/// all are held by one thread
+template <class... Mutexes>
+inline constexpr bool covers_nested_holds_v =
+    (((shared_node_pool<Mutexes>::size == 0U) ||
+      (shared_node_count_v<Mutexes, Mutexes...> <= shared_node_pool<Mutexes>::size)) &&
+     ...);
+
+}  // namespace detail
 
 }  // namespace exclusive
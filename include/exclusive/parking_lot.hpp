@@ -0,0 +1,250 @@
+#pragma once
+
+#include "interference_size.hpp"
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+
+/// @brief Provides exclusive access to shared resources
+namespace exclusive {
+
+/// @brief Process-wide table of threads waiting on addresses
+///
+/// Threads park on an address, such as the address of a lock, and are
+/// unparked in FIFO order. Parked threads are kept in a fixed size hash table
+/// of wait queues so that the objects parked on do not need to store any
+/// queue themselves.
+///
+/// Similar to WebKit's `ParkingLot`.
+class parking_lot {
+  public:
+    /// @brief Result of parking a thread
+    enum class park_result {
+        /// The thread was unparked by `unpark_one`
+        unparked,
+        /// The deadline was reached before the thread was unparked
+        timeout,
+        /// Validation failed and the thread was not parked
+        invalid,
+    };
+
+    /// @brief Result of unparking a thread, passed to the unpark callback
+    struct unpark_result {
+        /// Set if a thread was unparked
+        bool unparked;
+        /// Set if there may be more threads parked on the same address
+        bool may_have_more;
+    };
+
+  private:
+    struct waiter {
+        const void* address{};
+        waiter* next{};
+
+        std::mutex mutex{};
+        std::condition_variable cv{};
+        bool unparked{};
+        std::uintptr_t token{};
+    };
+
+    struct alignas(hardware_destructive_interference_size) bucket {
+        std::mutex mutex{};
+        waiter* head{};
+        waiter* tail{};
+
+        auto push(waiter* w) -> void
+        {
+            w->next = nullptr;
+            (tail != nullptr ? tail->next : head) = w;
+            tail = w;
+        }
+
+        // Removes the first waiter matching `pred`, returning it if found
+        template <class Pred>
+        auto remove_if(Pred pred) -> waiter*
+        {
+            waiter* prev = nullptr;
+            for (auto* w = head; w != nullptr; prev = w, w = w->next) {
+                if (pred(w)) {
+                    (prev != nullptr ? prev->next : head) = w->next;
+                    if (tail == w) {
+                        tail = prev;
+                    }
+                    return w;
+                }
+            }
+            return nullptr;
+        }
+
+        [[nodiscard]] auto contains(const void* address) const -> bool
+        {
+            for (const auto* w = head; w != nullptr; w = w->next) {
+                if (w->address == address) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    static constexpr std::size_t bucket_count = 256;
+
+    std::array<bucket, bucket_count> buckets_{};
+
+    static auto instance() -> parking_lot&
+    {
+        static auto lot = parking_lot{};
+        return lot;
+    }
+
+    static auto bucket_for(const void* address) -> bucket&
+    {
+        // Fibonacci hashing, discarding low bits that are likely equal due to
+        // alignment
+        constexpr auto multiplier = std::uint64_t{11400714819323198485U};
+        const std::uint64_t key = reinterpret_cast<std::uintptr_t>(address);
+        const auto index = ((key >> 3U) * multiplier) >> 56U;
+
+        static_assert(bucket_count == (std::size_t{1} << 8U));
+        return instance().buckets_[index];
+    }
+
+    template <class Validate, class Wait>
+    static auto
+    park_impl(const void* address, Validate& validate, Wait wait, std::uintptr_t* token)
+        -> park_result
+    {
+        auto& b = bucket_for(address);
+        auto w = waiter{};
+        w.address = address;
+
+        {
+            const auto lock = std::lock_guard{b.mutex};
+            if (!validate()) {
+                return park_result::invalid;
+            }
+            b.push(&w);
+        }
+
+        {
+            auto lock = std::unique_lock{w.mutex};
+            if (wait(w.cv, lock, w.unparked)) {
+                if (token != nullptr) {
+                    *token = w.token;
+                }
+                return park_result::unparked;
+            }
+        }
+
+        // leave the queue unless already removed by an unparking thread
+        {
+            const auto lock = std::lock_guard{b.mutex};
+            if (b.remove_if([&w](const auto* other) { return other == &w; }) != nullptr) {
+                return park_result::timeout;
+            }
+        }
+
+        // The unparking thread may still access `w`
+        auto lock = std::unique_lock{w.mutex};
+        w.cv.wait(lock, [&w] { return w.unparked; });
+        if (token != nullptr) {
+            *token = w.token;
+        }
+        return park_result::unparked;
+    }
+
+  public:
+    /// @brief Park the calling thread on an address
+    /// @param address Address to park on
+    /// @param validate Predicate invoked while the wait queue is locked. The
+    ///     thread is only parked if it returns `true`.
+    /// @param token If not null, set to the token passed by `unpark_one`
+    /// @return `unparked` or `invalid`
+    template <class Validate>
+    static auto park(const void* address, Validate validate, std::uintptr_t* token = nullptr)
+        -> park_result
+    {
+        return park_impl(
+            address,
+            validate,
+            [](auto& cv, auto& lock, const bool& unparked) {
+                cv.wait(lock, [&unparked] { return unparked; });
+                return true;
+            },
+            token);
+    }
+
+    /// @brief Park the calling thread on an address until a deadline
+    /// @param address Address to park on
+    /// @param validate Predicate invoked while the wait queue is locked. The
+    ///     thread is only parked if it returns `true`.
+    /// @param deadline Time point after which the thread stops waiting
+    /// @param token If not null, set to the token passed by `unpark_one`
+    /// @return Result of parking the thread
+    ///
+    /// If the thread is removed from the wait queue by `unpark_one` before it
+    /// leaves the queue, `unparked` is returned, even if after the deadline.
+    template <class Validate, class Clock, class Duration>
+    static auto park_until(const void* address,
+                           Validate validate,
+                           const std::chrono::time_point<Clock, Duration>& deadline,
+                           std::uintptr_t* token = nullptr) -> park_result
+    {
+        return park_impl(
+            address,
+            validate,
+            [&deadline](auto& cv, auto& lock, const bool& unparked) {
+                while (!unparked) {
+                    if (cv.wait_until(lock, deadline) == std::cv_status::timeout) {
+                        return unparked;
+                    }
+                }
+                return true;
+            },
+            token);
+    }
+
+    /// @brief Unpark the thread that has been parked the longest on an address
+    /// @param address Address to unpark a thread from
+    /// @param callback Invocable with signature `void(unpark_result)` or
+    ///     `std::uintptr_t(unpark_result)`, invoked while the wait queue is
+    ///     locked and before the thread is woken
+    ///
+    /// The callback allows state associated with the address to be updated
+    /// atomically with respect to threads parking on that address. A value
+    /// returned by the callback is passed to the unparked thread as a token.
+    template <class Callback>
+    static auto unpark_one(const void* address, Callback callback) -> void
+    {
+        auto& b = bucket_for(address);
+        waiter* w = nullptr;
+        auto token = std::uintptr_t{};
+
+        {
+            const auto lock = std::lock_guard{b.mutex};
+            w = b.remove_if([address](const auto* other) { return other->address == address; });
+
+            const auto result = unpark_result{w != nullptr, (w != nullptr) && b.contains(address)};
+            if constexpr (std::is_void_v<std::invoke_result_t<Callback&, unpark_result>>) {
+                callback(result);
+            } else {
+                token = callback(result);
+            }
+        }
+
+        if (w != nullptr) {
+            // notify while holding the lock as `w` may not outlive it otherwise
+            const auto lock = std::lock_guard{w->mutex};
+            w->token = token;
+            w->unparked = true;
+            w->cv.notify_one();
+        }
+    }
+};
+
+}  // namespace exclusive
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "interference_size.hpp"
+#include "mutex.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/// @brief Provides exclusive access to shared resources
+namespace exclusive {
+
+/// @brief Mutex implementing a ticket lock
+///
+/// @tparam Backoff Number of spin iterations a waiter delays for each thread
+///     ahead of it in the queue before checking the lock again
+///
+/// Threads take a ticket and wait until it is served. Locks are granted in
+/// FIFO order. The lock state is a next ticket counter and a now serving
+/// counter, kept on separate cache lines, so the mutex needs no node pool.
+///
+/// Waiters back off in proportion to their distance from the head of the
+/// queue, reducing traffic on the now serving counter.
+///
+/// A waiter that times out abandons its ticket, and the ticket is skipped
+/// when it is served. At most 64 tickets following the one being served can
+/// be abandoned, so a waiter further back may wait past its deadline until
+/// it is within 64 tickets of the head.
+///
+/// @note Implements TimedMutex
+template <std::size_t Backoff = 32>
+class ticket_mutex {
+    using ticket = std::size_t;
+
+    static constexpr auto abandon_limit = ticket{64};
+
+    alignas(hardware_prefetch_interference_size) std::atomic<ticket> next_{};
+
+    alignas(hardware_prefetch_interference_size) std::atomic<ticket> serving_{};
+
+    // Abandoned tickets, indexed by ticket modulo `abandon_limit`. Kept off
+    // the now serving line, so that a waiter timing out does not disturb the
+    // waiters spinning on it.
+    alignas(hardware_prefetch_interference_size) std::atomic<std::uint64_t> abandoned_{};
+
+    static constexpr auto bit(ticket t) -> std::uint64_t
+    {
+        return std::uint64_t{1} << (t % abandon_limit);
+    }
+
+    // Returns `false` if the ticket cannot be abandoned yet
+    auto abandon(ticket t) -> bool
+    {
+        // Tickets further from the head may alias a pending ticket
+        if (t - serving_.load(std::memory_order_relaxed) >= abandon_limit) {
+            return false;
+        }
+
+        const auto mask = bit(t);
+
+        // (T3) mark the ticket as abandoned
+        // ordered with (T4)
+        abandoned_.fetch_or(mask, std::memory_order_seq_cst);
+
+        // (T5) check if the ticket was served before it was marked
+        // ordered with (T1)
+        if (serving_.load(std::memory_order_seq_cst) == t) {
+            // withdraw the mark unless the ticket has already been skipped
+            if ((abandoned_.fetch_and(~mask, std::memory_order_seq_cst) & mask) != 0U) {
+                unlock();
+            }
+        }
+
+        return true;
+    }
+
+    template <class Expired>
+    auto wait(ticket t, Expired expired) -> bool
+    {
+        for (;;) {
+            // (T2) wait for the ticket to be served
+            // synchronizes with (T1)
+            const auto s = serving_.load(std::memory_order_acquire);
+            if (s == t) {
+                return true;
+            }
+
+            if (expired() && abandon(t)) {
+                return false;
+            }
+
+            for (auto i = (t - s) * Backoff; i != 0U; --i) {
+                detail::cpu_relax();
+            }
+        }
+    }
+
+  public:
+    ticket_mutex()
+    {
+        next_.store(0U, std::memory_order_relaxed);
+        serving_.store(0U, std::memory_order_relaxed);
+        abandoned_.store(0U, std::memory_order_relaxed);
+    }
+
+    ~ticket_mutex() = default;
+
+    ticket_mutex(const ticket_mutex&) = delete;
+    ticket_mutex(ticket_mutex&&) = delete;
+    auto operator=(const ticket_mutex&) -> ticket_mutex& = delete;
+    auto operator=(ticket_mutex&&) -> ticket_mutex& = delete;
+
+    auto lock() -> void
+    {
+        wait(next_.fetch_add(1U, std::memory_order_relaxed), [] { return false; });
+    }
+
+    auto try_lock() -> bool
+    {
+        // (T2) check the lock is free
+        // synchronizes with (T1)
+        auto t = serving_.load(std::memory_order_acquire);
+
+        return next_.compare_exchange_strong(
+            t, t + 1U, std::memory_order_relaxed, std::memory_order_relaxed);
+    }
+
+    template <class Rep, class Period>
+    auto try_lock_for(const std::chrono::duration<Rep, Period>& duration) -> bool
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    template <class Clock, class Duration>
+    auto try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline) -> bool
+    {
+        if (try_lock()) {
+            return true;
+        }
+
+        return wait(next_.fetch_add(1U, std::memory_order_relaxed),
+                    [&deadline] { return Clock::now() >= deadline; });
+    }
+
+    auto unlock() -> void
+    {
+        auto t = serving_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            ++t;
+
+            // (T1) serve the next ticket
+            // synchronizes with (T2), ordered with (T5)
+            serving_.store(t, std::memory_order_seq_cst);
+
+            const auto mask = bit(t);
+
+            // (T4) skip the ticket if abandoned
+            // ordered with (T3)
+            if (((abandoned_.load(std::memory_order_seq_cst) & mask) == 0U) ||
+                ((abandoned_.fetch_and(~mask, std::memory_order_seq_cst) & mask) == 0U)) {
+                return;
+            }
+        }
+    }
+};
+
+template <std::size_t Backoff>
+struct is_transferable<ticket_mutex<Backoff>> : std::true_type {};
+
+}  // namespace exclusive
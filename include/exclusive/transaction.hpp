@@ -0,0 +1,275 @@
+#pragma once
+
+#include "exclusive.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/// @brief Provides exclusive access to shared resources
+namespace exclusive {
+
+namespace detail {
+template <class... Resources>
+class transaction;
+}  // namespace detail
+
+/// @brief A shared resource with lock-free versioned snapshots
+/// @tparam T Resource type
+/// @tparam Mutex Mutex type, used to serialize writers
+///
+/// Stores a small, trivially copyable resource without padding so that it
+/// can be read without locking. Writes are serialized by a mutex and bump a
+/// version number, which readers use to detect torn or stale reads (i.e. a
+/// seqlock). The resource is modified with `transact`.
+template <class T, class Mutex = std::timed_mutex>
+class versioned_resource {
+    static_assert(std::is_object_v<T>);
+    static_assert(std::is_default_constructible_v<T>);
+    static_assert(std::is_trivially_copyable_v<T>);
+    static_assert(std::has_unique_object_representations_v<T>,
+                  "Resource must not contain padding, as writes are detected by comparing bytes.");
+
+    // Resource storage is accessed word-wise with atomics as readers
+    // are allowed to race with a writer.
+    using word = std::uintptr_t;
+    static constexpr auto word_count = (sizeof(T) + sizeof(word) - 1U) / sizeof(word);
+
+    template <class...>
+    friend class detail::transaction;
+
+  public:
+    using resource_type = T;
+    using mutex_type = Mutex;
+    using version_type = std::uint64_t;
+
+    /// @brief A consistent copy of the resource
+    struct snapshot {
+        T value;
+
+        /// Version of `value`. Always even.
+        version_type version;
+    };
+
+  private:
+    // Even when stable, odd while a write is in progress
+    std::atomic<version_type> version_{};
+    std::array<std::atomic<word>, word_count> storage_{};
+    Mutex mutex_{};
+
+    /// @brief Marks a write in progress if the version is unchanged
+    /// @pre `mutex_` is held by the calling thread
+    /// @return `true` if marked, after which `write` or `unmark` must be called
+    auto mark(version_type expected) -> bool
+    {
+        if (version_.load(std::memory_order_relaxed) != expected) {
+            return false;
+        }
+
+        // (V5) mark write in progress, before validating other resources
+        // ordered with (V6)
+        version_.store(expected + 1U, std::memory_order_seq_cst);
+        return true;
+    }
+
+    /// @pre The resource is marked by the calling thread
+    auto unmark() -> void
+    {
+        version_.store(version_.load(std::memory_order_relaxed) - 1U, std::memory_order_release);
+    }
+
+    /// @pre The resource is marked by the calling thread
+    auto write(const T& value) -> void
+    {
+        auto words = std::array<word, word_count>{};
+        std::memcpy(words.data(), &value, sizeof(T));
+
+        const auto v = version_.load(std::memory_order_relaxed);
+
+        for (auto i = std::size_t{}; i != word_count; ++i) {
+            // (V1) store resource, ordered after the version update
+            // synchronizes with (V4)
+            storage_[i].store(words[i], std::memory_order_release);
+        }
+
+        // (V2) publish write
+        // synchronizes with (V3)
+        version_.store(v + 1U, std::memory_order_release);
+    }
+
+    /// Odd if another transaction is committing a write
+    [[nodiscard]] auto version() const -> version_type
+    {
+        // (V6) load version, after marking written resources
+        // ordered with (V5)
+        return version_.load(std::memory_order_seq_cst);
+    }
+
+  public:
+    /// @brief Constructs a versioned resource using the type's default constructor
+    versioned_resource()
+    {
+        version_.store(0U, std::memory_order_relaxed);
+
+        auto words = std::array<word, word_count>{};
+        const auto value = T{};
+        std::memcpy(words.data(), &value, sizeof(T));
+
+        for (auto i = std::size_t{}; i != word_count; ++i) {
+            storage_[i].store(words[i], std::memory_order_relaxed);
+        }
+    }
+
+    ~versioned_resource() = default;
+
+    versioned_resource(const versioned_resource&) = delete;
+    versioned_resource(versioned_resource&&) = delete;
+    auto operator=(const versioned_resource&) -> versioned_resource& = delete;
+    auto operator=(versioned_resource&&) -> versioned_resource& = delete;
+
+    /// @brief Read the resource without locking
+    /// @return A consistent snapshot of the resource
+    ///
+    /// Retries while a write is in progress.
+    [[nodiscard]] auto read() const -> snapshot
+    {
+        auto words = std::array<word, word_count>{};
+
+        for (;;) {
+            // (V3) load version before reading the resource
+            // synchronizes with (V1), (V2)
+            const auto v = version_.load(std::memory_order_acquire);
+            if ((v % 2U) != 0U) {
+                continue;
+            }
+
+            for (auto i = std::size_t{}; i != word_count; ++i) {
+                // (V4) load resource, ordered before the version recheck
+                // synchronizes with (V1)
+                words[i] = storage_[i].load(std::memory_order_acquire);
+            }
+
+            // check that no write started while reading
+            if (v == version_.load(std::memory_order_relaxed)) {
+                auto s = snapshot{T{}, v};
+                std::memcpy(&s.value, words.data(), sizeof(T));
+                return s;
+            }
+        }
+    }
+};
+
+namespace detail {
+
+/// @brief Optimistic transaction over a set of versioned resources
+template <class... Resources>
+class transaction {
+    static constexpr auto size = sizeof...(Resources);
+
+    std::tuple<Resources&...> resources_;
+    std::tuple<std::unique_lock<typename Resources::mutex_type>...> locks_;
+    std::array<std::size_t, size> order_;
+
+  public:
+    explicit transaction(Resources&... rs)
+        : resources_{rs...},
+          locks_{std::unique_lock{rs.mutex_, std::defer_lock}...},
+          order_{lock_order(locks_)}
+    {}
+
+    template <class F>
+    auto run(F& f) -> std::size_t
+    {
+        return run(f, std::index_sequence_for<Resources...>{});
+    }
+
+  private:
+    template <class F, std::size_t... Is>
+    auto run(F& f, std::index_sequence<Is...>) -> std::size_t
+    {
+        for (auto attempt = std::size_t{1};; ++attempt) {
+            const auto before = std::tuple{std::get<Is>(resources_).read()...};
+            auto after = std::tuple{std::get<Is>(before).value...};
+
+            std::invoke(f, std::get<Is>(after)...);
+
+            const auto written = std::array<bool, size>{
+                (std::memcmp(&std::get<Is>(after),
+                             &std::get<Is>(before).value,
+                             sizeof(std::get<Is>(after))) != 0)...};
+
+            // only resources that are written need to be locked
+            for (auto i : order_) {
+                if (written[i]) {
+                    visit_at(locks_, i, [](auto& lk) {
+                        lk.lock();
+                        return true;
+                    });
+                }
+            }
+
+            // written resources are marked before validating those only read,
+            // so that a concurrent transaction writing a resource in the read
+            // set is detected, even if it has not committed
+            const auto marked = std::array<bool, size>{
+                (written[Is] && std::get<Is>(resources_).mark(std::get<Is>(before).version))...};
+
+            // all snapshots must still be current, including those only read
+            const auto valid =
+                ((written[Is] ? marked[Is]
+                              : (std::get<Is>(resources_).version() ==
+                                 std::get<Is>(before).version)) &&
+                 ...);
+
+            ((marked[Is] ? (valid ? std::get<Is>(resources_).write(std::get<Is>(after))
+                                  : std::get<Is>(resources_).unmark())
+                         : void()),
+             ...);
+
+            unlock_all(locks_);
+
+            if (valid) {
+                return attempt;
+            }
+        }
+    }
+};
+
+}  // namespace detail
+
+/// @brief Atomically update multiple versioned resources
+/// @param f Invocable with signature `void(Ts&...)`
+/// @param resources Distinct versioned resources
+/// @return Number of attempts needed to commit
+///
+/// Invokes `f` with copies of lock-free snapshots of each resource. Then only
+/// the resources modified by `f` are locked, in a global order, and marked as
+/// being written. If no resource has been written or marked by another
+/// transaction since its snapshot was taken, the modified values are
+/// committed. Otherwise, the transaction is retried. Two transactions that
+/// each read a resource the other writes cannot both commit.
+///
+/// A modification is detected by comparing the bytes of each resource with its
+/// snapshot.
+///
+/// A transaction that modifies nothing does not lock any mutexes, but its
+/// snapshots are validated in the same way. The invocation of `f` for the
+/// attempt that commits therefore observes mutually consistent snapshots.
+/// Earlier invocations may observe snapshots taken across another commit. As
+/// `f` may be invoked multiple times, it should have no side effects other
+/// than modifying its arguments, or results should only be used from the last
+/// invocation.
+template <class F, class... Ts, class... Mutexes>
+auto transact(F&& f, versioned_resource<Ts, Mutexes>&... resources) -> std::size_t
+{
+    return detail::transaction<versioned_resource<Ts, Mutexes>...>{resources...}.run(f);
+}
+
+}  // namespace exclusive
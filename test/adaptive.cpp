@@ -0,0 +1,124 @@
+#include "exclusive/adaptive_mutex.hpp"
+#include "exclusive/exclusive.hpp"
+#include "exclusive/test/access_task.hpp"
+#include "exclusive/test/fake_clock.hpp"
+
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+namespace {
+using namespace std::literals::chrono_literals;
+namespace test = exclusive::test;
+}  // namespace
+
+// Given an adaptive_mutex,
+// When locking without contention,
+// Then the mutex does not inflate.
+TEST(AdaptiveLock, UncontendedDoesNotInflate)
+{
+    auto mut = exclusive::adaptive_mutex<2>{};
+
+    EXPECT_TRUE(mut.try_lock());
+    EXPECT_FALSE(mut.try_lock());
+    mut.unlock();
+
+    EXPECT_TRUE(mut.try_lock_for(0s));
+    mut.unlock();
+
+    EXPECT_FALSE(mut.inflated());
+}
+
+// Given an unlocked adaptive_mutex,
+// When locking with a deadline that has already passed,
+// Then the lock word is acquired before the deadline is checked.
+TEST(AdaptiveLock, UncontendedIgnoresExpiredDeadline)
+{
+    auto mut = exclusive::adaptive_mutex<2>{};
+
+    EXPECT_TRUE(mut.try_lock_until(test::fake_clock::now() - 1s));
+    EXPECT_FALSE(mut.try_lock_until(test::fake_clock::now() - 1s));
+    mut.unlock();
+
+    EXPECT_TRUE(mut.try_lock_for(-1s));
+    mut.unlock();
+
+    EXPECT_FALSE(mut.inflated());
+}
+
+// Given an adaptive_mutex held by another thread,
+// When a thread spins on the lock beyond the spin limit,
+// Then the mutex inflates, and deflates after enough quiet releases.
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST(AdaptiveLock, InflatesAndDeflates)
+{
+    constexpr auto quiet_releases = std::size_t{4};
+    auto mut = exclusive::adaptive_mutex<2, 1, quiet_releases>{};
+
+    auto task1 = test::AccessTask{mut};
+    task1.wait_for_access();
+
+    const auto deadline = test::fake_clock::now() + 1s;
+    auto task2 = test::AccessTask{mut, deadline};
+
+    while (!mut.inflated()) {}
+    EXPECT_FALSE(task2.has_access());
+
+    EXPECT_TRUE(task1.terminate());
+    task2.wait_for_access();
+    EXPECT_TRUE(task2.terminate());
+
+    for (auto i = std::size_t{1}; i != quiet_releases; ++i) {
+        EXPECT_TRUE(mut.inflated());
+        mut.lock();
+        mut.unlock();
+    }
+
+    EXPECT_FALSE(mut.inflated());
+}
+
+// Given an inflated adaptive_mutex held by another thread,
+// When waiting on the lock until a deadline,
+// Then locking fails after the deadline is reached.
+TEST(AdaptiveLock, TimeoutWhileInflated)
+{
+    auto mut = exclusive::adaptive_mutex<2, 1>{};
+
+    auto task1 = test::AccessTask{mut};
+    task1.wait_for_access();
+
+    const auto deadline = test::fake_clock::now() + 1s;
+    auto task2 = test::AccessTask{mut, deadline};
+
+    while (!mut.inflated()) {}
+
+    test::fake_clock::set_now(deadline);
+    EXPECT_FALSE(task2.get());
+
+    EXPECT_TRUE(task1.terminate());
+    EXPECT_TRUE(mut.try_lock());
+}
+
+TEST(SharedResourceAdaptiveLock, AccessFromMultipleThreads)
+{
+    auto x = exclusive::shared_resource<int, exclusive::adaptive_mutex<4, 16, 4>>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+    auto t3 = std::thread{inc_n, n};
+    auto t4 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    EXPECT_EQ(4 * n, *x.access());
+}
@@ -0,0 +1,102 @@
+#include "exclusive/barging_mutex.hpp"
+#include "exclusive/exclusive.hpp"
+#include "exclusive/test/access_task.hpp"
+#include "exclusive/test/fake_clock.hpp"
+
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+namespace {
+using namespace std::literals::chrono_literals;
+namespace test = exclusive::test;
+}  // namespace
+
+// Given a barging_mutex,
+// When locking without contention,
+// Then no thread barges ahead of a queue.
+TEST(BargingLock, Uncontended)
+{
+    auto mut = exclusive::barging_mutex<2>{};
+
+    EXPECT_TRUE(mut.try_lock());
+    EXPECT_FALSE(mut.try_lock());
+    mut.unlock();
+
+    EXPECT_TRUE(mut.try_lock_for(0s));
+    mut.unlock();
+
+    mut.lock();
+    mut.unlock();
+
+    EXPECT_EQ(0U, mut.bypassed());
+}
+
+// Given a barging_mutex without a bypass budget and a queued thread,
+// When the lock is released,
+// Then an arriving thread cannot barge ahead of the queued thread.
+TEST(BargingLock, NoBargingWithoutBypass)
+{
+    auto mut = exclusive::barging_mutex<2, 0>{};
+
+    mut.lock();
+
+    auto task = test::AccessTask{mut};
+    while (mut.queue_count() == 0U) {}
+
+    mut.unlock();
+    EXPECT_FALSE(mut.try_lock());
+
+    task.wait_for_access();
+    EXPECT_TRUE(task.terminate());
+
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+// Given a barging_mutex held by another thread,
+// When waiting on the lock until a deadline,
+// Then locking fails after the deadline is reached.
+TEST(BargingLock, Timeout)
+{
+    auto mut = exclusive::barging_mutex<2>{};
+
+    auto task1 = test::AccessTask{mut};
+    task1.wait_for_access();
+
+    const auto deadline = test::fake_clock::now() + 10ms;
+    auto task2 = test::AccessTask{mut, deadline};
+
+    while (mut.queue_count() == 0U) {}
+
+    test::fake_clock::set_now(deadline);
+    EXPECT_FALSE(task2.get());
+
+    EXPECT_TRUE(task1.terminate());
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+TEST(SharedResourceBargingLock, AccessFromMultipleThreads)
+{
+    auto x = exclusive::shared_resource<int, exclusive::barging_mutex<4, 2, 16>>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+    auto t3 = std::thread{inc_n, n};
+    auto t4 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    EXPECT_EQ(4 * n, *x.access());
+}
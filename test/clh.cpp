@@ -3,8 +3,11 @@
 #include "exclusive/test/fake_clock.hpp"
 
 #include "gtest/gtest.h"
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <future>
+#include <thread>
 #include <utility>
 
 namespace {
@@ -42,14 +45,43 @@ auto queue_n_with_timeouts(Mutex& mut, Durations... dur)
     return std::array{spawn_first(), spawn_next(dur)...};
 }
 
+template <class Mutex>
+class ClhPoolSize : public testing::Test {};
+
+template <class Mutex>
+class ClhQueue : public testing::Test {};
+
+template <class Mutex>
+class SharedResourceClhPoolSize : public testing::Test {};
+
+// Pool sizes with a specialized clh_mutex, and a pool size using the node queue
+using clh_mutex_types =
+    testing::Types<exclusive::clh_mutex<1>, exclusive::clh_mutex<2>, exclusive::clh_mutex<4>>;
+
+// A clh_mutex with fewer than 3 nodes does not count every waiting thread
+using clh_queue_types = testing::Types<
+    exclusive::clh_mutex<3>,
+    exclusive::clh_mutex<4, exclusive::failure::die>,
+    exclusive::
+        clh_mutex<4, exclusive::failure::retry, exclusive::pool::local, exclusive::depth::ticketed>,
+    exclusive::
+        clh_mutex<exclusive::dynamic_extent, exclusive::failure::die, exclusive::pool::thread_owned>>;
+
+static_assert(sizeof(exclusive::clh_mutex<1>) <= exclusive::hardware_destructive_interference_size);
+static_assert(sizeof(exclusive::clh_mutex<2>) <= exclusive::hardware_destructive_interference_size);
+
 }  // namespace
 
+TYPED_TEST_SUITE(ClhPoolSize, clh_mutex_types);
+TYPED_TEST_SUITE(ClhQueue, clh_queue_types);
+TYPED_TEST_SUITE(SharedResourceClhPoolSize, clh_mutex_types);
+
 // Given a clh_mutex,
 // When there is an uncontested lock request,
 // Then it should succeed with non-positive durations.
-TEST(ClhLock, TryLockForNonPositiveDuration)
+TYPED_TEST(ClhPoolSize, TryLockForNonPositiveDuration)
 {
-    auto mut = exclusive::clh_mutex<1>{};
+    auto mut = TypeParam{};
 
     // No contention so both calls to `try_lock_for` should succeed
     EXPECT_TRUE(mut.try_lock_for(0s));
@@ -62,9 +94,9 @@ TEST(ClhLock, TryLockForNonPositiveDuration)
 // Given a clh_mutex,
 // When waiting on a lock until a deadline,
 // Then locking fails after the deadline is reached.
-TEST(ClhLock, TimeoutWithFakeClock)
+TYPED_TEST(ClhPoolSize, TimeoutWithFakeClock)
 {
-    auto mut = exclusive::clh_mutex<3>{};
+    auto mut = TypeParam{};
 
     // launch thread 1 and 2, where 1 acquires access and 2 spins waiting on the
     // lock
@@ -77,17 +109,39 @@ TEST(ClhLock, TimeoutWithFakeClock)
     // advance time and wait for task2 to timeout on lock acquire
     test::fake_clock::set_now(deadline);
     EXPECT_FALSE(task[1].get());
+    EXPECT_EQ(1U, mut.queue_count());
 
     // signal task1 to end
     EXPECT_TRUE(task[0].terminate());
+    EXPECT_EQ(0U, mut.queue_count());
+
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+// Given a clh_mutex,
+// When a thread waits on the lock,
+// Then it acquires the lock after it is released.
+TYPED_TEST(ClhPoolSize, WaiterAcquiresOnRelease)
+{
+    auto mut = TypeParam{};
+
+    const auto deadline = test::fake_clock::now() + 1s;
+    auto task = queue_n_with_timeouts(mut, deadline);
+
+    EXPECT_TRUE(task[0].terminate());
+    task[1].wait_for_access();
+
+    EXPECT_TRUE(task[1].terminate());
+    EXPECT_EQ(0U, mut.queue_count());
 }
 
 // Given a clh_mutex,
 // When queuing a bunch of threads on the lock,
 // Then threads are given access in queue order.
-TEST(ClhLock, FairnessInQueueAccess)
+TYPED_TEST(ClhQueue, FairnessInQueueAccess)
 {
-    auto mut = exclusive::clh_mutex<3>{};
+    auto mut = TypeParam{};
 
     const auto deadline = test::fake_clock::now() + 1s;
     auto task = queue_n_with_timeouts(mut, deadline, deadline);
@@ -103,15 +157,16 @@ TEST(ClhLock, FairnessInQueueAccess)
     task[2].wait_for_access();
 
     EXPECT_TRUE(task[2].terminate());
+    EXPECT_EQ(0U, mut.queue_count());
 }
 
 // Given a clh_mutex and 3 threads requesting access in order,
 // When queuing 3 threads on the lock and thread 2 times-out,
 // Then thread3 gets access after thread1 releases access.
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
-TEST(ClhLock, AbandonnedRequestIsSkippedOver)
+TYPED_TEST(ClhQueue, AbandonnedRequestIsSkippedOver)
 {
-    auto mut = exclusive::clh_mutex<3>{};
+    auto mut = TypeParam{};
 
     const auto now = test::fake_clock::now();
     auto task = queue_n_with_timeouts(mut, now + 100ms, now + 200ms);
@@ -130,15 +185,17 @@ TEST(ClhLock, AbandonnedRequestIsSkippedOver)
     task[2].wait_for_access();
 
     EXPECT_TRUE(task[2].terminate());
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
 }
 
 // Given a clh_mutex and 3 threads requesting access in order,
 // When time advances and threads 2 and 3 time-out, while holding onto the lock in thread 1,
 // Then the mutex is lockable after thread 1 releases access.
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
-TEST(ClhLock, AllAbandonnedRequestsAreSkipped)
+TYPED_TEST(ClhQueue, AllAbandonnedRequestsAreSkipped)
 {
-    auto mut = exclusive::clh_mutex<3>{};
+    auto mut = TypeParam{};
 
     const auto now = test::fake_clock::now();
     auto task = queue_n_with_timeouts(mut, now + 100ms, now + 200ms);
@@ -156,4 +213,646 @@ TEST(ClhLock, AllAbandonnedRequestsAreSkipped)
     EXPECT_TRUE(task[0].terminate());
 
     EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+TYPED_TEST(SharedResourceClhPoolSize, AccessFromMultipleThreads)
+{
+    auto x = exclusive::shared_resource<int, TypeParam>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+    auto t3 = std::thread{inc_n, n};
+    auto t4 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    EXPECT_EQ(4 * n, *x.access());
+}
+
+
+// Given a clh_mutex and 4 threads requesting access in order,
+// When threads 2 to 4 time-out while thread 1 holds the lock,
+// Then nodes of the abandonned requests are reclaimed without any thread acquiring the lock.
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST(ClhLock, AbandonnedNodesAreReclaimed)
+{
+    auto mut = exclusive::clh_mutex<4, exclusive::failure::die>{};
+
+    const auto now = test::fake_clock::now();
+    auto task = queue_n_with_timeouts(mut, now + 100ms, now + 100ms, now + 100ms);
+
+    test::fake_clock::set_now(now + 100ms);
+    EXPECT_FALSE(task[1].get());
+    EXPECT_FALSE(task[2].get());
+    EXPECT_FALSE(task[3].get());
+    EXPECT_EQ(1U, mut.queue_count());
+
+    auto waiters = std::array{mut.enqueue_until(test::fake_clock::now()),
+                              mut.enqueue_until(test::fake_clock::now()),
+                              mut.enqueue_until(test::fake_clock::now())};
+
+    for (auto& w : waiters) {
+        ASSERT_TRUE(w);
+    }
+    for (auto it = waiters.rbegin(); it != waiters.rend(); ++it) {
+        mut.abandon(*it);
+    }
+
+    EXPECT_TRUE(task[0].terminate());
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+// Given a clh_mutex that is held or has waiters,
+// When calling try_lock,
+// Then it fails without queuing on the lock.
+TEST(ClhLock, TryLockDoesNotQueueWhenHeld)
+{
+    auto mut = exclusive::clh_mutex<2, exclusive::failure::die>{};
+    mut.lock();
+
+    EXPECT_FALSE(mut.try_lock());
+    EXPECT_EQ(1U, mut.queue_count());
+
+    auto waiter = mut.enqueue_until(test::fake_clock::now());
+    ASSERT_TRUE(waiter);
+
+    EXPECT_FALSE(mut.try_lock());
+    EXPECT_EQ(2U, mut.queue_count());
+
+    mut.abandon(waiter);
+    EXPECT_FALSE(mut.try_lock());
+    EXPECT_EQ(1U, mut.queue_count());
+
+    mut.unlock();
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+// Given a locked clh_mutex,
+// When a waiter queues on the lock,
+// Then polling only succeeds after the lock is released.
+TYPED_TEST(ClhPoolSize, WaiterPollsWithoutBlocking)
+{
+    auto mut = TypeParam{};
+    mut.lock();
+
+    auto waiter = mut.enqueue_until(test::fake_clock::now());
+    ASSERT_TRUE(waiter);
+    EXPECT_EQ(2U, mut.queue_count());
+    EXPECT_FALSE(mut.poll(waiter));
+
+    mut.unlock();
+    EXPECT_TRUE(mut.poll(waiter));
+    EXPECT_FALSE(waiter);
+
+    mut.unlock();
+    EXPECT_EQ(0U, mut.queue_count());
+}
+
+// Given a locked clh_mutex,
+// When a waiter abandons the queue,
+// Then the lock is available after it is released.
+TYPED_TEST(ClhPoolSize, AbandonnedWaiterIsSkippedOver)
+{
+    auto mut = TypeParam{};
+    mut.lock();
+
+    auto waiter = mut.enqueue_until(test::fake_clock::now());
+    ASSERT_TRUE(waiter);
+
+    mut.abandon(waiter);
+    EXPECT_FALSE(waiter);
+    EXPECT_EQ(1U, mut.queue_count());
+
+    mut.unlock();
+    EXPECT_TRUE(mut.try_lock());
+}
+
+// Given clh_mutexes sharing a node pool,
+// When locking and unlocking each mutex,
+// Then an unlocked mutex does not hold any nodes.
+TEST(ClhSharedPool, UnlockedMutexesHoldNoNodes)
+{
+    struct group {};
+    using mutex = exclusive::clh_mutex<1, exclusive::failure::die, exclusive::pool::shared<group>>;
+
+    static_assert(sizeof(mutex) <= 3 * sizeof(void*));
+
+    auto muts = std::array<mutex, 100>{};
+
+    for (auto i = std::size_t{1}; i != muts.size(); ++i) {
+        EXPECT_TRUE(muts[i - 1].try_lock());
+        EXPECT_TRUE(muts[i].try_lock());
+        muts[i - 1].unlock();
+        muts[i].unlock();
+    }
+}
+
+// Given clh_mutexes sharing a node pool,
+// When a mutex is destroyed with a released node in its queue,
+// Then the nodes held by the mutex are returned to the pool.
+TEST(ClhSharedPool, DestructionReturnsNodes)
+{
+    struct group {};
+    using mutex = exclusive::clh_mutex<1, exclusive::failure::die, exclusive::pool::shared<group>>;
+
+    {
+        auto mut = mutex{};
+        mut.lock();
+
+        auto waiter = mut.enqueue_until(test::fake_clock::now());
+        ASSERT_TRUE(waiter);
+
+        // the released node is not the tail, so it stays in the queue
+        mut.unlock();
+        mut.abandon(waiter);
+
+        // only one node is left in the pool
+        auto others = std::array<mutex, 2>{};
+        EXPECT_TRUE(others[0].try_lock());
+        EXPECT_FALSE(others[1].try_lock());
+        others[0].unlock();
+    }
+
+    auto muts = std::array<mutex, 2>{};
+    EXPECT_TRUE(muts[0].try_lock());
+    EXPECT_TRUE(muts[1].try_lock());
+    muts[0].unlock();
+    muts[1].unlock();
+}
+
+// Given clh_mutexes sharing a node pool,
+// When a waiter abandons the tail of a queue,
+// Then its node is returned to the pool.
+TEST(ClhSharedPool, AbandonnedTailNodeIsReturned)
+{
+    struct group {};
+    using mutex = exclusive::clh_mutex<1, exclusive::failure::die, exclusive::pool::shared<group>>;
+
+    auto mut = mutex{};
+    mut.lock();
+
+    auto waiter = mut.enqueue_until(test::fake_clock::now());
+    ASSERT_TRUE(waiter);
+
+    auto other = mutex{};
+    EXPECT_FALSE(other.try_lock());
+
+    mut.abandon(waiter);
+    EXPECT_TRUE(other.try_lock());
+
+    other.unlock();
+    mut.unlock();
+}
+
+TEST(SharedResourceClhSharedPool, AccessFromMultipleThreads)
+{
+    struct group {};
+    using mutex = exclusive::clh_mutex<4, exclusive::failure::retry, exclusive::pool::shared<group>>;
+
+    auto xs = std::array<exclusive::shared_resource<int, mutex>, 3>{};
+
+    const auto inc_n = [&xs](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*xs[i % xs.size()].access()); }
+    };
+
+    constexpr auto n = 999U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+    auto t3 = std::thread{inc_n, n};
+    auto t4 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    for (auto& x : xs) {
+        EXPECT_EQ(4 * n / xs.size(), *x.access());
+    }
+}
+
+// Given clh_mutexes sharing node pools,
+// When a thread may hold several of them at once,
+// Then each pool must have a node for every mutex held.
+TEST(SharedResourceClhSharedPool, NestedHoldsFitInPool)
+{
+    struct group {};
+    using single = exclusive::clh_mutex<1, exclusive::failure::retry, exclusive::pool::shared<group>>;
+    using pair = exclusive::clh_mutex<2, exclusive::failure::retry, exclusive::pool::shared<group>>;
+
+    static_assert(exclusive::detail::covers_nested_holds_v<single, pair>);
+    static_assert(exclusive::detail::covers_nested_holds_v<pair, pair>);
+    static_assert(!exclusive::detail::covers_nested_holds_v<single, single>);
+    static_assert(!exclusive::detail::covers_nested_holds_v<pair, pair, pair>);
+
+    auto a = exclusive::shared_resource<int, pair>{};
+    auto b = exclusive::shared_resource<int, pair>{};
+
+    EXPECT_TRUE(exclusive::access_all(a, b));
+    EXPECT_TRUE(exclusive::access_any(a, b));
+}
+
+// Given a clh_mutex with a runtime-sized pool,
+// When waiting on the lock,
+// Then the number of waiters is limited by the pool size.
+TEST(ClhDynamicPool, SizedAtConstruction)
+{
+    using mutex = exclusive::clh_mutex<exclusive::dynamic_extent>;
+
+    const auto wait_on = [](mutex& mut) {
+        mut.lock();
+
+        auto waiter1 = mut.enqueue_until(test::fake_clock::now());
+        auto waiter2 = mut.enqueue_until(test::fake_clock::now());
+        const auto queued = static_cast<bool>(waiter1) + static_cast<bool>(waiter2);
+
+        for (auto* w : {&waiter1, &waiter2}) {
+            if (*w) {
+                mut.abandon(*w);
+            }
+        }
+        mut.unlock();
+
+        return queued;
+    };
+
+    auto mut1 = mutex{1};
+    EXPECT_EQ(1, wait_on(mut1));
+
+    auto mut2 = mutex{2};
+    EXPECT_EQ(2, wait_on(mut2));
+}
+
+// Given a clh_mutex with a runtime-sized pool,
+// When constructed with nodes provided by the caller,
+// Then the mutex uses those nodes.
+TEST(ClhDynamicPool, CallerProvidedNodes)
+{
+    using mutex = exclusive::clh_mutex<exclusive::dynamic_extent>;
+
+    auto arena = std::array<mutex::node_type, mutex::nodes_required(2)>{};
+    auto mut = mutex{arena.data(), arena.data() + arena.size()};
+
+    const auto deadline = test::fake_clock::now() + 1s;
+    auto task = queue_n_with_timeouts(mut, deadline);
+
+    EXPECT_TRUE(task[0].has_access());
+    EXPECT_FALSE(task[1].has_access());
+
+    EXPECT_TRUE(task[0].terminate());
+    task[1].wait_for_access();
+    EXPECT_TRUE(task[1].terminate());
+}
+
+TEST(SharedResourceClhDynamicPool, AccessFromMultipleThreads)
+{
+    auto x = exclusive::shared_resource<int, exclusive::clh_mutex<exclusive::dynamic_extent>>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+
+    EXPECT_EQ(2 * n, *x.access());
+}
+
+TEST(SharedResourceClhThreadOwned, AccessFromShortLivedThreads)
+{
+    using mutex = exclusive::clh_mutex<exclusive::dynamic_extent,
+                                       exclusive::failure::die,
+                                       exclusive::pool::thread_owned>;
+
+    auto x = exclusive::shared_resource<int, mutex>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 100U;
+    constexpr auto bursts = 10U;
+
+    for (auto i = 0U; i != bursts; ++i) {
+        auto threads = std::array<std::thread, 8>{};
+        for (auto& t : threads) {
+            t = std::thread{inc_n, n};
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    EXPECT_EQ(bursts * 8 * n, *x.access());
+}
+
+// Given a clh_mutex with thread-owned nodes,
+// When short-lived threads try to lock while others hold the lock,
+// Then nodes released by exiting threads are not inspected.
+TEST(ClhThreadOwned, TryLockFromShortLivedThreads)
+{
+    auto mut =
+        exclusive::clh_mutex<exclusive::dynamic_extent,
+                             exclusive::failure::die,
+                             exclusive::pool::thread_owned>{};
+
+    auto count = 0U;
+
+    const auto inc_n = [&mut, &count](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) {
+            if (!mut.try_lock()) {
+                mut.lock();
+            }
+            ++count;
+            mut.unlock();
+        }
+    };
+
+    constexpr auto n = 100U;
+    constexpr auto bursts = 10U;
+
+    for (auto i = 0U; i != bursts; ++i) {
+        auto threads = std::array<std::thread, 8>{};
+        for (auto& t : threads) {
+            t = std::thread{inc_n, n};
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    EXPECT_TRUE(mut.try_lock());
+    EXPECT_EQ(bursts * 8 * n, count);
+    mut.unlock();
+}
+
+// Given a clh_mutex with an exhausted pool and the wait failure policy,
+// When a thread locks until a deadline,
+// Then locking fails after the deadline is reached.
+TEST(ClhWaitingPool, TimeoutWaitingForNode)
+{
+    auto mut = exclusive::clh_mutex<1, exclusive::failure::wait>{};
+    mut.lock();
+
+    auto waiter = mut.enqueue_until(test::fake_clock::now());
+    ASSERT_TRUE(waiter);
+
+    const auto deadline = test::fake_clock::now() + 10ms;
+    auto task = test::AccessTask{mut, deadline};
+
+    test::fake_clock::set_now(deadline);
+    EXPECT_FALSE(task.get());
+
+    mut.unlock();
+    EXPECT_TRUE(mut.poll(waiter));
+    mut.unlock();
+}
+
+// Given a clh_mutex with an exhausted pool and the wait failure policy,
+// When a node is released,
+// Then a thread waiting for a node acquires the lock.
+TEST(ClhWaitingPool, ReleasedNodeIsHandedOff)
+{
+    auto mut = exclusive::clh_mutex<1, exclusive::failure::wait>{};
+    mut.lock();
+
+    auto waiter = mut.enqueue_until(test::fake_clock::now());
+    ASSERT_TRUE(waiter);
+
+    auto task = test::AccessTask{mut};
+    EXPECT_FALSE(task.has_access());
+
+    mut.unlock();
+    EXPECT_TRUE(mut.poll(waiter));
+    EXPECT_FALSE(task.has_access());
+
+    mut.unlock();
+    task.wait_for_access();
+    EXPECT_TRUE(task.terminate());
+}
+
+TEST(SharedResourceClhWaitingPool, AccessFromMultipleThreads)
+{
+    auto x = exclusive::shared_resource<int, exclusive::clh_mutex<2, exclusive::failure::wait>>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+    auto t3 = std::thread{inc_n, n};
+    auto t4 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    EXPECT_EQ(4 * n, *x.access());
+}
+
+// Given a clh_mutex with ticketed queue depth,
+// When threads join and leave the queue,
+// Then the queue count is derived from the queued nodes.
+TEST(ClhTicketedDepth, QueueCountIsDerived)
+{
+    auto mut = exclusive::
+        clh_mutex<3, exclusive::failure::die, exclusive::pool::local, exclusive::depth::ticketed>{};
+    EXPECT_EQ(0U, mut.queue_count());
+
+    mut.lock();
+    EXPECT_EQ(1U, mut.queue_count());
+
+    auto first = mut.enqueue_until(test::fake_clock::now());
+    auto second = mut.enqueue_until(test::fake_clock::now());
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(3U, mut.queue_count());
+
+    mut.abandon(second);
+    EXPECT_EQ(2U, mut.queue_count());
+
+    mut.unlock();
+    EXPECT_TRUE(mut.poll(first));
+    EXPECT_EQ(1U, mut.queue_count());
+
+    mut.unlock();
+    EXPECT_EQ(0U, mut.queue_count());
+}
+
+// Given a clh_mutex with two nodes and ticketed queue depth,
+// When threads wait on the lock,
+// Then every waiting thread is counted.
+TEST(ClhTicketedDepth, SmallPoolCountsEveryWaiter)
+{
+    auto mut = exclusive::
+        clh_mutex<2, exclusive::failure::retry, exclusive::pool::local, exclusive::depth::ticketed>{};
+    mut.lock();
+
+    auto first = mut.enqueue_until(test::fake_clock::now());
+    auto second = mut.enqueue_until(test::fake_clock::now());
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(3U, mut.queue_count());
+
+    mut.unlock();
+    EXPECT_TRUE(mut.poll(first));
+    EXPECT_FALSE(mut.poll(second));
+
+    mut.unlock();
+    EXPECT_TRUE(mut.poll(second));
+
+    mut.unlock();
+    EXPECT_EQ(0U, mut.queue_count());
+}
+
+// Given clh_mutexes with ticketed queue depth sharing a node pool,
+// When a mutex is unlocked,
+// Then it has no queued threads.
+TEST(ClhTicketedDepth, SharedPoolUnlockedMutexHasNoQueue)
+{
+    struct group {};
+    using mutex = exclusive::clh_mutex<1,
+                                       exclusive::failure::die,
+                                       exclusive::pool::shared<group>,
+                                       exclusive::depth::ticketed>;
+
+    static_assert(sizeof(mutex) <= 3 * sizeof(void*));
+
+    auto mut = mutex{};
+
+    for (auto i = 0; i != 3; ++i) {
+        EXPECT_TRUE(mut.try_lock());
+        EXPECT_EQ(1U, mut.queue_count());
+
+        mut.unlock();
+        EXPECT_EQ(0U, mut.queue_count());
+    }
+}
+
+TEST(SharedResourceClhTicketedDepth, AccessFromMultipleThreads)
+{
+    using mutex = exclusive::
+        clh_mutex<4, exclusive::failure::retry, exclusive::pool::local, exclusive::depth::ticketed>;
+
+    auto x = exclusive::shared_resource<int, mutex>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+    auto t3 = std::thread{inc_n, n};
+    auto t4 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    EXPECT_EQ(4 * n, *x.access());
+    EXPECT_EQ(0U, x.queue_count());
+}
+
+// Given a locked clh_mutex with two nodes and a waiter,
+// When the lock is released,
+// Then it is passed to the waiter and not to another thread.
+TEST(ClhHandoff, LockIsPassedToWaiter)
+{
+    auto mut = exclusive::clh_mutex<2>{};
+    mut.lock();
+
+    auto waiter = mut.enqueue_until(test::fake_clock::now());
+    ASSERT_TRUE(waiter);
+    EXPECT_TRUE(mut.contended());
+    EXPECT_EQ(2U, mut.queue_count());
+
+    mut.unlock();
+    EXPECT_FALSE(mut.try_lock());
+    EXPECT_EQ(1U, mut.queue_count());
+
+    EXPECT_TRUE(mut.poll(waiter));
+    EXPECT_FALSE(mut.contended());
+
+    mut.unlock();
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+// Given a locked clh_mutex with two nodes and a waiter,
+// When another thread waits on the lock,
+// Then it is pending without blocking and only queues after the waiter leaves.
+TEST(ClhHandoff, FurtherThreadWaitsToQueue)
+{
+    auto mut = exclusive::clh_mutex<2>{};
+    mut.lock();
+
+    auto waiter = mut.enqueue_until(test::fake_clock::now());
+    ASSERT_TRUE(waiter);
+
+    auto other = mut.enqueue_until(test::fake_clock::time_point::max());
+    ASSERT_TRUE(other);
+    EXPECT_FALSE(mut.poll(other));
+    EXPECT_EQ(2U, mut.queue_count());
+
+    mut.abandon(waiter);
+    EXPECT_FALSE(waiter);
+    EXPECT_EQ(1U, mut.queue_count());
+
+    EXPECT_FALSE(mut.poll(other));
+    EXPECT_EQ(2U, mut.queue_count());
+
+    mut.unlock();
+    EXPECT_TRUE(mut.poll(other));
+    mut.unlock();
+    EXPECT_EQ(0U, mut.queue_count());
+}
+
+// Given a locked clh_mutex with two nodes and a waiter,
+// When a pending thread stops waiting,
+// Then the waiter is still passed the lock.
+TEST(ClhHandoff, PendingWaiterAbandonsWithoutQueuing)
+{
+    auto mut = exclusive::clh_mutex<2>{};
+    mut.lock();
+
+    auto waiter = mut.enqueue_until(test::fake_clock::now());
+    auto other = mut.enqueue_until(test::fake_clock::now());
+    ASSERT_TRUE(other);
+
+    mut.abandon(other);
+    EXPECT_FALSE(other);
+    EXPECT_EQ(2U, mut.queue_count());
+
+    mut.unlock();
+    EXPECT_TRUE(mut.poll(waiter));
+    mut.unlock();
+    EXPECT_EQ(0U, mut.queue_count());
 }
@@ -0,0 +1,131 @@
+#include "exclusive/cna_mutex.hpp"
+#include "exclusive/exclusive.hpp"
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// A topology where the NUMA node of each thread is set by the test
+struct fake_topology {
+    static inline thread_local unsigned node = 0U;
+    static inline std::atomic<std::size_t> calls{};
+
+    static auto current_node() -> unsigned
+    {
+        ++calls;
+        return node;
+    }
+};
+
+// Locks `mut` from a thread on NUMA node `node`, appending `id` to `order`
+// once access is acquired. Returns after the thread has queued on the lock.
+template <class Mutex>
+auto queue_on(Mutex& mut, unsigned node, int id, std::vector<int>& order)
+{
+    const auto calls = fake_topology::calls.load();
+
+    auto task = std::async(std::launch::async, [&mut, node, id, &order] {
+        fake_topology::node = node;
+        const auto lock = std::lock_guard{mut};
+        order.push_back(id);
+    });
+
+    while (fake_topology::calls.load() == calls) {}
+
+    return task;
+}
+
+}  // namespace
+
+// Given a cna_mutex held by a thread on NUMA node 0,
+// When threads on nodes 1 and 0 queue on the lock in that order,
+// Then the thread on node 0 is granted the lock first.
+TEST(CnaLock, PrefersWaiterOnSameNode)
+{
+    static_assert(!exclusive::is_transferable_v<exclusive::cna_mutex<fake_topology>>);
+
+    auto mut = exclusive::cna_mutex<fake_topology>{};
+    auto order = std::vector<int>{};
+
+    mut.lock();
+
+    auto task1 = queue_on(mut, 1U, 1, order);
+    auto task2 = queue_on(mut, 0U, 2, order);
+
+    mut.unlock();
+    task1.get();
+    task2.get();
+
+    EXPECT_EQ((std::vector{2, 1}), order);
+}
+
+// Given a cna_mutex with a fairness window of 1,
+// When waiters on another node are skipped over,
+// Then they are granted the lock after the window is reached.
+TEST(CnaLock, SkippedWaitersGrantedAfterWindow)
+{
+    auto mut = exclusive::cna_mutex<fake_topology, 1>{};
+    auto order = std::vector<int>{};
+
+    mut.lock();
+
+    auto task1 = queue_on(mut, 1U, 1, order);
+    auto task2 = queue_on(mut, 0U, 2, order);
+    auto task3 = queue_on(mut, 0U, 3, order);
+
+    mut.unlock();
+    task1.get();
+    task2.get();
+    task3.get();
+
+    EXPECT_EQ((std::vector{2, 1, 3}), order);
+}
+
+TEST(SharedResourceCnaLock, AccessFromMultipleThreads)
+{
+    auto x = exclusive::shared_resource<int, exclusive::cna_mutex<fake_topology, 4>>{};
+
+    const auto inc_n = [&x](unsigned node, std::size_t n) {
+        fake_topology::node = node;
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, 0U, n};
+    auto t2 = std::thread{inc_n, 1U, n};
+    auto t3 = std::thread{inc_n, 0U, n};
+    auto t4 = std::thread{inc_n, 1U, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    EXPECT_EQ(4 * n, *x.access());
+}
+
+TEST(SharedResourceCnaLock, NativeTopology)
+{
+    auto x = exclusive::shared_resource<int, exclusive::cna_mutex<>>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+
+    EXPECT_EQ(2 * n, *x.access());
+}
@@ -0,0 +1,174 @@
+#include "exclusive/compact_mutex.hpp"
+#include "exclusive/exclusive.hpp"
+#include "exclusive/parking_lot.hpp"
+#include "exclusive/test/access_task.hpp"
+#include "exclusive/test/fake_clock.hpp"
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <thread>
+
+namespace {
+using namespace std::literals::chrono_literals;
+namespace test = exclusive::test;
+
+using park_result = exclusive::parking_lot::park_result;
+
+// Parks on `address`, setting `parked` once the thread is in the wait queue
+auto park_async(const void* address, std::atomic_bool& parked)
+{
+    return std::async(std::launch::async, [address, &parked] {
+        return exclusive::parking_lot::park(address, [&parked] {
+            parked.store(true);
+            return true;
+        });
+    });
+}
+}  // namespace
+
+// Given threads parked on an address,
+// When unparking threads one at a time,
+// Then threads are unparked in FIFO order.
+TEST(ParkingLot, UnparksInFifoOrder)
+{
+    const auto address = 0;
+    auto parked1 = std::atomic_bool{};
+    auto parked2 = std::atomic_bool{};
+
+    auto task1 = park_async(&address, parked1);
+    while (!parked1.load()) {}
+
+    auto task2 = park_async(&address, parked2);
+    while (!parked2.load()) {}
+
+    auto result = exclusive::parking_lot::unpark_result{};
+    const auto record = [&result](auto r) { result = r; };
+
+    exclusive::parking_lot::unpark_one(&address, record);
+    EXPECT_TRUE(result.unparked);
+    EXPECT_TRUE(result.may_have_more);
+    EXPECT_EQ(park_result::unparked, task1.get());
+    EXPECT_EQ(std::future_status::timeout, task2.wait_for(0s));
+
+    exclusive::parking_lot::unpark_one(&address, record);
+    EXPECT_TRUE(result.unparked);
+    EXPECT_FALSE(result.may_have_more);
+    EXPECT_EQ(park_result::unparked, task2.get());
+
+    exclusive::parking_lot::unpark_one(&address, record);
+    EXPECT_FALSE(result.unparked);
+    EXPECT_FALSE(result.may_have_more);
+}
+
+// Given a parking lot,
+// When parking with a failing validation or until a past deadline,
+// Then the thread does not remain parked.
+TEST(ParkingLot, InvalidAndTimeout)
+{
+    const auto address = 0;
+
+    EXPECT_EQ(park_result::invalid,
+              exclusive::parking_lot::park(&address, [] { return false; }));
+    EXPECT_EQ(park_result::timeout,
+              exclusive::parking_lot::park_until(
+                  &address, [] { return true; }, std::chrono::steady_clock::now()));
+
+    auto result = exclusive::parking_lot::unpark_result{};
+    exclusive::parking_lot::unpark_one(&address, [&result](auto r) { result = r; });
+    EXPECT_FALSE(result.unparked);
+}
+
+// Given a compact_mutex,
+// When locking without contention,
+// Then the mutex behaves as a TimedMutex and occupies a single byte.
+TEST(CompactLock, Uncontended)
+{
+    static_assert(sizeof(exclusive::compact_mutex) == 1U);
+
+    auto mut = exclusive::compact_mutex{};
+
+    EXPECT_TRUE(mut.try_lock());
+    EXPECT_FALSE(mut.try_lock());
+    EXPECT_FALSE(mut.try_lock_for(0s));
+    mut.unlock();
+
+    mut.lock();
+    mut.unlock();
+}
+
+// Given a compact_mutex held by another thread,
+// When waiting on the lock until a deadline,
+// Then locking fails after the deadline is reached.
+TEST(CompactLock, Timeout)
+{
+    auto mut = exclusive::compact_mutex{};
+
+    auto task1 = test::AccessTask{mut};
+    task1.wait_for_access();
+
+    const auto deadline = test::fake_clock::now() + 10ms;
+    auto task2 = test::AccessTask{mut, deadline};
+
+    test::fake_clock::set_now(deadline);
+    EXPECT_FALSE(task2.get());
+
+    EXPECT_TRUE(task1.terminate());
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+// Given a compact_mutex held by another thread,
+// When the lock is released,
+// Then ownership passes to the waiting thread.
+TEST(CompactLock, ReleaseToWaiter)
+{
+    auto mut = exclusive::compact_mutex{};
+
+    auto task1 = test::AccessTask{mut};
+    task1.wait_for_access();
+
+    auto task2 = test::AccessTask{mut};
+    EXPECT_FALSE(task2.has_access());
+
+    EXPECT_TRUE(task1.terminate());
+    task2.wait_for_access();
+    EXPECT_FALSE(mut.try_lock());
+
+    EXPECT_TRUE(task2.terminate());
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+// Given a shared_resource using a compact_mutex, without leases,
+// When the resource is declared,
+// Then it only stores the resource and mutex.
+TEST(SharedResourceCompactLock, OnlyStoresResourceAndMutex)
+{
+    static_assert(sizeof(exclusive::shared_resource<char, exclusive::compact_mutex>) == 2U);
+}
+
+TEST(SharedResourceCompactLock, AccessFromMultipleThreads)
+{
+    auto x = exclusive::shared_resource<int, exclusive::compact_mutex>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+    auto t3 = std::thread{inc_n, n};
+    auto t4 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    EXPECT_EQ(4 * n, *x.access());
+}
@@ -0,0 +1,115 @@
+#include "exclusive/exclusive.hpp"
+#include "exclusive/hemlock_mutex.hpp"
+
+#include "gtest/gtest.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <mutex>
+#include <thread>
+
+// Given a hemlock_mutex,
+// When locking without contention,
+// Then the mutex behaves as a Lockable and occupies a single word.
+TEST(Hemlock, Uncontended)
+{
+    static_assert(sizeof(exclusive::hemlock_mutex) == sizeof(void*));
+
+    auto mut = exclusive::hemlock_mutex{};
+
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+
+    mut.lock();
+    mut.unlock();
+}
+
+// Given a hemlock_mutex held by another thread,
+// When the lock is released,
+// Then a thread waiting on the lock acquires it.
+TEST(Hemlock, WaiterAcquiresOnRelease)
+{
+    auto mut = exclusive::hemlock_mutex{};
+
+    mut.lock();
+
+    auto task = std::async(std::launch::async, [&mut] {
+        EXPECT_FALSE(mut.try_lock());
+
+        const auto lock = std::lock_guard{mut};
+        return true;
+    });
+
+    EXPECT_EQ(std::future_status::timeout, task.wait_for(std::chrono::milliseconds{1}));
+
+    mut.unlock();
+    EXPECT_TRUE(task.get());
+
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+// Given a shared_resource using a hemlock_mutex, without leases,
+// When the resource is declared,
+// Then it only stores the resource and mutex.
+TEST(SharedResourceHemlock, OnlyStoresResourceAndMutex)
+{
+    static_assert(sizeof(exclusive::shared_resource<int, exclusive::hemlock_mutex>) ==
+                  2 * sizeof(void*));
+}
+
+TEST(SharedResourceHemlock, AccessFromMultipleThreads)
+{
+    auto x = exclusive::shared_resource<int, exclusive::hemlock_mutex>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+    auto t3 = std::thread{inc_n, n};
+    auto t4 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    EXPECT_EQ(4 * n, *x.access());
+}
+
+// Given threads each holding two hemlock_mutexes at once,
+// When the locks are contended,
+// Then the single grant word of each thread is reused for both locks.
+TEST(Hemlock, HoldMultipleLocks)
+{
+    auto outer = exclusive::hemlock_mutex{};
+    auto inner = exclusive::hemlock_mutex{};
+    auto count = std::array<int, 2>{};
+
+    const auto inc_n = [&](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) {
+            const auto lock_outer = std::lock_guard{outer};
+            ++count[0];
+            const auto lock_inner = std::lock_guard{inner};
+            ++count[1];
+        }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+    auto t3 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+
+    EXPECT_EQ(3 * n, count[0]);
+    EXPECT_EQ(3 * n, count[1]);
+}
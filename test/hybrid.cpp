@@ -0,0 +1,129 @@
+#include "exclusive/exclusive.hpp"
+#include "exclusive/hybrid_mutex.hpp"
+#include "exclusive/test/access_task.hpp"
+#include "exclusive/test/fake_clock.hpp"
+
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+namespace {
+using namespace std::literals::chrono_literals;
+namespace test = exclusive::test;
+}  // namespace
+
+// Given a hybrid_mutex,
+// When locking without contention,
+// Then no thread joins the queue.
+TEST(HybridLock, Uncontended)
+{
+    auto mut = exclusive::hybrid_mutex<2>{};
+
+    EXPECT_TRUE(mut.try_lock());
+    EXPECT_FALSE(mut.try_lock());
+    mut.unlock();
+
+    EXPECT_TRUE(mut.try_lock_for(0s));
+    mut.unlock();
+
+    mut.lock();
+    EXPECT_EQ(0U, mut.queue_count());
+    mut.unlock();
+}
+
+// Given a hybrid_mutex held by another thread,
+// When a single thread waits on the lock,
+// Then the thread waits without joining the queue.
+TEST(HybridLock, PendingWaiterDoesNotQueue)
+{
+    auto mut = exclusive::hybrid_mutex<2>{};
+
+    auto task1 = test::AccessTask{mut};
+    task1.wait_for_access();
+
+    auto task2 = test::AccessTask{mut};
+
+    EXPECT_FALSE(task2.has_access());
+    EXPECT_EQ(0U, mut.queue_count());
+
+    EXPECT_TRUE(task1.terminate());
+    task2.wait_for_access();
+    EXPECT_TRUE(task2.terminate());
+}
+
+// Given a hybrid_mutex held by another thread and a pending waiter,
+// When another thread waits on the lock,
+// Then the thread joins the queue and acquires the lock after the pending
+// waiter.
+TEST(HybridLock, FurtherWaitersQueue)
+{
+    auto mut = exclusive::hybrid_mutex<2>{};
+
+    mut.lock();
+
+    auto task1 = test::AccessTask{mut};
+    auto task2 = test::AccessTask{mut};
+
+    while (mut.queue_count() == 0U) {}
+    EXPECT_FALSE(task1.has_access());
+    EXPECT_FALSE(task2.has_access());
+
+    mut.unlock();
+
+    while (!task1.has_access() && !task2.has_access()) {}
+    auto& first = task1.has_access() ? task1 : task2;
+    auto& second = task1.has_access() ? task2 : task1;
+
+    EXPECT_TRUE(first.terminate());
+    second.wait_for_access();
+    EXPECT_TRUE(second.terminate());
+
+    EXPECT_EQ(0U, mut.queue_count());
+}
+
+// Given a hybrid_mutex held by another thread,
+// When pending and queued threads wait on the lock until a deadline,
+// Then locking fails after the deadline is reached.
+TEST(HybridLock, Timeout)
+{
+    auto mut = exclusive::hybrid_mutex<2>{};
+
+    auto task1 = test::AccessTask{mut};
+    task1.wait_for_access();
+
+    const auto deadline = test::fake_clock::now() + 10ms;
+    auto task2 = test::AccessTask{mut, deadline};
+    auto task3 = test::AccessTask{mut, deadline};
+
+    test::fake_clock::set_now(deadline);
+    EXPECT_FALSE(task2.get());
+    EXPECT_FALSE(task3.get());
+
+    EXPECT_TRUE(task1.terminate());
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+TEST(SharedResourceHybridLock, AccessFromMultipleThreads)
+{
+    auto x = exclusive::shared_resource<int, exclusive::hybrid_mutex<4>>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+    auto t3 = std::thread{inc_n, n};
+    auto t4 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    EXPECT_EQ(4 * n, *x.access());
+}
@@ -0,0 +1,209 @@
+#include "exclusive/exclusive.hpp"
+#include "exclusive/malthusian_mutex.hpp"
+#include "exclusive/test/access_task.hpp"
+#include "exclusive/test/fake_clock.hpp"
+
+#include "gtest/gtest.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+namespace {
+using namespace std::literals::chrono_literals;
+namespace test = exclusive::test;
+}  // namespace
+
+// Given a malthusian_mutex,
+// When locking without contention,
+// Then no thread is parked.
+TEST(MalthusianLock, Uncontended)
+{
+    auto mut = exclusive::malthusian_mutex<>{};
+
+    EXPECT_TRUE(mut.try_lock());
+    EXPECT_FALSE(mut.try_lock());
+    mut.unlock();
+
+    EXPECT_TRUE(mut.try_lock_for(0s));
+    mut.unlock();
+
+    mut.lock();
+    mut.unlock();
+
+    EXPECT_EQ(0U, mut.passive());
+}
+
+// Given a malthusian_mutex with a full active set,
+// When another thread waits on the lock,
+// Then the thread is parked until the active set drains.
+TEST(MalthusianLock, SurplusThreadIsPassive)
+{
+    auto mut = exclusive::malthusian_mutex<1>{};
+
+    auto task1 = test::AccessTask{mut};
+    task1.wait_for_access();
+
+    auto task2 = test::AccessTask{mut};
+
+    while (mut.passive() == 0U) {}
+    EXPECT_FALSE(task2.has_access());
+
+    EXPECT_TRUE(task1.terminate());
+    task2.wait_for_access();
+    EXPECT_TRUE(task2.terminate());
+
+    EXPECT_EQ(0U, mut.passive());
+}
+
+// Given a malthusian_mutex with a full active set,
+// When a parked thread waits on the lock until a deadline,
+// Then locking fails after the deadline is reached.
+TEST(MalthusianLock, TimeoutWhilePassive)
+{
+    auto mut = exclusive::malthusian_mutex<1>{};
+
+    auto task1 = test::AccessTask{mut};
+    task1.wait_for_access();
+
+    const auto deadline = test::fake_clock::now() + 10ms;
+    auto task2 = test::AccessTask{mut, deadline};
+
+    test::fake_clock::set_now(deadline);
+    EXPECT_FALSE(task2.get());
+
+    EXPECT_TRUE(task1.terminate());
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+// Given a malthusian_mutex with a full active set and a parked thread,
+// When a thread in the active set releases the lock to a queued waiter,
+// Then the parked thread remains parked.
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST(MalthusianLock, ActiveSetIsNotDisplaced)
+{
+    auto mut = exclusive::malthusian_mutex<2>{};
+
+    auto task1 = test::AccessTask{mut};
+    task1.wait_for_access();
+
+    auto task2 = test::AccessTask{mut};
+    auto task3 = test::AccessTask{mut};
+
+    while (mut.passive() == 0U) {}
+
+    EXPECT_TRUE(task1.terminate());
+    while (!task2.has_access() && !task3.has_access()) {}
+
+    auto& queued = task2.has_access() ? task2 : task3;
+    auto& parked = task2.has_access() ? task3 : task2;
+
+    EXPECT_EQ(1U, mut.passive());
+    EXPECT_FALSE(parked.has_access());
+
+    EXPECT_TRUE(queued.terminate());
+    parked.wait_for_access();
+    EXPECT_TRUE(parked.terminate());
+}
+
+// Given a malthusian_mutex with a full active set and a parked thread,
+// When a thread leaves the active set while another slot is free,
+// Then the parked thread is admitted without waiting for the active set to drain.
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST(MalthusianLock, ParkedThreadTakesFreeSlot)
+{
+    auto mut = exclusive::malthusian_mutex<3>{};
+    mut.lock();
+
+    auto tasks = std::array{test::AccessTask{mut}, test::AccessTask{mut}, test::AccessTask{mut}};
+
+    while (mut.passive() == 0U) {}
+
+    const auto next_holder = [&tasks](std::size_t skip) {
+        for (;;) {
+            for (auto i = std::size_t{}; i != tasks.size(); ++i) {
+                if ((i != skip) && tasks[i].has_access()) {
+                    return i;
+                }
+            }
+        }
+    };
+
+    // the releasing thread may take its slot again
+    mut.unlock();
+    const auto first = next_holder(tasks.size());
+    EXPECT_EQ(1U, mut.passive());
+
+    EXPECT_TRUE(tasks[first].terminate());
+    const auto second = next_holder(first);
+
+    auto parked = std::size_t{};
+    while ((parked == first) || (parked == second)) {
+        ++parked;
+    }
+
+    while (mut.passive() != 0U) {}
+    EXPECT_FALSE(tasks[parked].has_access());
+
+    EXPECT_TRUE(tasks[second].terminate());
+    tasks[parked].wait_for_access();
+    EXPECT_TRUE(tasks[parked].terminate());
+}
+
+// Given a malthusian_mutex with a full active set and a parked thread,
+// When the rotation period elapses,
+// Then the lock holder hands its place in the active set to the parked thread.
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST(MalthusianLock, ParkedThreadIsRotatedIn)
+{
+    auto mut = exclusive::malthusian_mutex<2, 1>{};
+
+    auto task1 = test::AccessTask{mut};
+    task1.wait_for_access();
+
+    auto task2 = test::AccessTask{mut};
+    auto task3 = test::AccessTask{mut};
+
+    while (mut.passive() == 0U) {}
+
+    EXPECT_TRUE(task1.terminate());
+    while (!task2.has_access() && !task3.has_access()) {}
+
+    auto& queued = task2.has_access() ? task2 : task3;
+    auto& parked = task2.has_access() ? task3 : task2;
+
+    while (mut.passive() != 0U) {}
+    EXPECT_FALSE(parked.has_access());
+
+    EXPECT_TRUE(queued.terminate());
+    parked.wait_for_access();
+    EXPECT_TRUE(parked.terminate());
+}
+
+TEST(SharedResourceMalthusianLock, AccessFromMultipleThreads)
+{
+    auto x = exclusive::shared_resource<int, exclusive::malthusian_mutex<2, 16>>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+    auto t3 = std::thread{inc_n, n};
+    auto t4 = std::thread{inc_n, n};
+    auto t5 = std::thread{inc_n, n};
+    auto t6 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+    t5.join();
+    t6.join();
+
+    EXPECT_EQ(6 * n, *x.access());
+}
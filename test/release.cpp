@@ -0,0 +1,141 @@
+// Built with NDEBUG to check that locking does not depend on assertions
+
+#include "exclusive/adaptive_mutex.hpp"
+#include "exclusive/barging_mutex.hpp"
+#include "exclusive/exclusive.hpp"
+#include "exclusive/hybrid_mutex.hpp"
+#include "exclusive/malthusian_mutex.hpp"
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <thread>
+
+#if !defined(NDEBUG)
+#error "This test must be built with NDEBUG defined."
+#endif
+
+namespace {
+using namespace std::literals::chrono_literals;
+
+template <class Mutex>
+class ReleaseLock : public testing::Test {};
+
+using mutex_types = testing::Types<exclusive::clh_mutex<4>,
+                                   exclusive::adaptive_mutex<4>,
+                                   exclusive::barging_mutex<4, 0>,
+                                   exclusive::hybrid_mutex<4>,
+                                   exclusive::malthusian_mutex<4>>;
+
+}  // namespace
+
+TYPED_TEST_SUITE(ReleaseLock, mutex_types);
+
+// Given a locked mutex,
+// When another thread calls lock,
+// Then it only returns after the mutex is unlocked.
+TYPED_TEST(ReleaseLock, LockWaitsForHolder)
+{
+    auto mut = TypeParam{};
+    mut.lock();
+
+    auto acquired = std::atomic_bool{};
+    auto other = std::thread{[&mut, &acquired] {
+        mut.lock();
+        acquired = true;
+        mut.unlock();
+    }};
+
+    std::this_thread::sleep_for(50ms);
+    EXPECT_FALSE(acquired);
+
+    mut.unlock();
+    other.join();
+    EXPECT_TRUE(acquired);
+}
+
+TYPED_TEST(ReleaseLock, AccessFromMultipleThreads)
+{
+    auto x = exclusive::shared_resource<int, TypeParam>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+    auto t3 = std::thread{inc_n, n};
+    auto t4 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    EXPECT_EQ(4 * n, *x.access());
+}
+
+// Given a locked hybrid_mutex with a pending waiter,
+// When a further thread calls lock,
+// Then it queues and only returns after both are done.
+TEST(ReleaseHybridLock, QueuedLockWaitsForHolder)
+{
+    auto mut = exclusive::hybrid_mutex<4>{};
+    mut.lock();
+
+    auto acquired = std::atomic_uint{};
+    const auto lock_once = [&mut, &acquired] {
+        mut.lock();
+        ++acquired;
+        mut.unlock();
+    };
+
+    auto pending = std::thread{lock_once};
+    auto queued = std::thread{lock_once};
+
+    while (mut.queue_count() == 0U) {}
+
+    std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(0U, acquired);
+
+    mut.unlock();
+    pending.join();
+    queued.join();
+    EXPECT_EQ(2U, acquired);
+}
+
+// Given a thread holding access to a clh_mutex protected resource,
+// When it yields access to a waiting thread,
+// Then it holds the lock again afterwards.
+TEST(ReleaseClhLock, YieldIfContendedReacquires)
+{
+    auto x = exclusive::shared_resource<int, exclusive::clh_mutex<4>>{};
+
+    auto on_access = std::promise<void>{};
+    auto has_access = on_access.get_future();
+
+    auto task = std::async(
+        std::launch::async,
+        [&x](auto on_access) {
+            auto access_scope = x.access();
+            on_access.set_value();
+
+            while (!access_scope.yield_if_contended()) {}
+
+            EXPECT_EQ(1, *access_scope);
+            EXPECT_FALSE(std::async(std::launch::async, [&x] {
+                             return x.access_within(0s).owns_lock();
+                         }).get());
+        },
+        std::move(on_access));
+
+    has_access.wait();
+
+    ++*x.access();
+
+    task.get();
+}
@@ -3,9 +3,12 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <future>
+#include <mutex>
 #include <system_error>
 #include <thread>
 
@@ -18,8 +21,84 @@ auto status_is(const std::future<T>& fut) -> bool
     return Status == fut.wait_for(0s);
 }
 
+// Last overrun reported to `record_overrun`
+std::atomic<const char*> overrun_holder{};
+std::atomic_bool overrun_reported{};
+
+auto record_overrun(const exclusive::lease_overrun& overrun) -> void
+{
+    EXPECT_GT(overrun.held, overrun.budget);
+
+    overrun_holder.store(overrun.holder);
+    overrun_reported.store(true);
+}
+
+struct isolated_counter {
+    int value{};
+};
+
+struct colocated_counter {
+    int value{};
+};
+
+struct leased_counter {
+    int value{};
+};
+
+auto offset_of(const void* member, const void* object) -> std::uintptr_t
+{
+    return reinterpret_cast<std::uintptr_t>(member) - reinterpret_cast<std::uintptr_t>(object);
+}
+
+template <class Mutex>
+class SharedResourceClhQueue : public testing::Test {};
+
+template <class Mutex>
+class SharedResourceClhHandoff : public testing::Test {};
+
+template <class Mutex>
+class SharedResourceAccessAll : public testing::Test {};
+
+template <class Mutex>
+class SharedResourceAccessAny : public testing::Test {};
+
+template <class Mutex>
+class SharedResourceClhLease : public testing::Test {};
+
+// Pool sizes with a specialized clh_mutex, and a pool size using the node queue
+using clh_mutex_types =
+    testing::Types<exclusive::clh_mutex<1>, exclusive::clh_mutex<2>, exclusive::clh_mutex<4>>;
+
+// A single node clh_mutex does not grant the lock in order
+using fifo_clh_mutex_types = testing::Types<exclusive::clh_mutex<2>, exclusive::clh_mutex<4>>;
+
 }  // namespace
 
+TYPED_TEST_SUITE(SharedResourceClhQueue, clh_mutex_types);
+TYPED_TEST_SUITE(SharedResourceClhHandoff, fifo_clh_mutex_types);
+TYPED_TEST_SUITE(SharedResourceAccessAll, clh_mutex_types);
+TYPED_TEST_SUITE(SharedResourceAccessAny, clh_mutex_types);
+TYPED_TEST_SUITE(SharedResourceClhLease, clh_mutex_types);
+
+namespace exclusive {
+
+template <>
+struct resource_layout<isolated_counter, std::mutex> {
+    using type = layout::isolated;
+};
+
+template <>
+struct resource_layout<colocated_counter, std::mutex> {
+    using type = layout::colocated;
+};
+
+template <class Mutex>
+struct resource_lease<leased_counter, Mutex> {
+    using type = lease::monitored;
+};
+
+}  // namespace exclusive
+
 TEST(SharedResource, AccessFromMultipleThreads)
 {
     auto x = exclusive::shared_resource<int, exclusive::array_mutex<4>>{};
@@ -43,6 +122,7 @@ TEST(SharedResource, AccessFromMultipleThreads)
     EXPECT_EQ(4 * n, *x.access());
 }
 
+#if defined(__cpp_exceptions)
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 TEST(SharedResource, ThrowsWhenSlotsExceeded)
 {
@@ -78,6 +158,7 @@ TEST(SharedResource, ThrowsWhenSlotsExceeded)
     p2.set_value();
     p3.set_value();
 }
+#endif
 
 TEST(SharedResourceClhLock, AccessFromMultipleThreads)
 {
@@ -102,6 +183,7 @@ TEST(SharedResourceClhLock, AccessFromMultipleThreads)
     EXPECT_EQ(4 * n, *x.access());
 }
 
+#if defined(__cpp_exceptions)
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 TEST(SharedResourceClhLock, ThrowsWhenSlotsExceeded)
 {
@@ -168,10 +250,74 @@ TEST(SharedResourceClhLock, ThrowsWhenSlotsExceeded)
     p2.set_value();
     p3.set_value();
 }
+#endif
+
+TEST(SharedResourceClhLock, TryAccessReportsSlotsExceeded)
+{
+    // With 1 (+ 2) slots, no slot is available while one thread holds access
+    // and another waits (see `ThrowsWhenSlotsExceeded`)
+    auto x = exclusive::shared_resource<int, exclusive::clh_mutex<1, exclusive::failure::die>>{};
+
+    auto waiting = std::future<void>{};
+    {
+        auto access_scope = x.access();
+        ASSERT_TRUE(access_scope);
+
+        waiting = std::async(std::launch::async, [&x] { EXPECT_TRUE(x.access()); });
+        while (x.queue_count() != 2U) {}
+
+        std::async(std::launch::async, [&x] {
+            auto ec = std::error_code{};
+
+            EXPECT_FALSE(x.try_access_within(1s, ec));
+            EXPECT_EQ(exclusive::slots_exceeded_error(), ec);
+        }).get();
+    }
+
+    waiting.get();
+}
 
-TEST(SharedResourceClhLock, ScopedAccessFailureOnTimeout)
+TYPED_TEST(SharedResourceClhQueue, TryAccessReportsTimeout)
 {
-    auto x = exclusive::shared_resource<int, exclusive::clh_mutex<2>>{};
+    auto x = exclusive::shared_resource<int, TypeParam>{};
+
+    auto ec = std::make_error_code(std::errc::timed_out);
+    {
+        auto access_scope = x.try_access_within(0s, ec);
+
+        ASSERT_TRUE(access_scope);
+        EXPECT_FALSE(ec);
+
+        std::async(std::launch::async, [&x] {
+            auto other_ec = std::error_code{};
+
+            EXPECT_FALSE(x.try_access_within(0s, other_ec));
+            EXPECT_EQ(std::make_error_code(std::errc::timed_out), other_ec);
+        }).get();
+    }
+
+    EXPECT_TRUE(x.try_access_within(0s, ec));
+    EXPECT_FALSE(ec);
+}
+
+TEST(SharedResource, TryAccessReportsTimeout)
+{
+    auto x = exclusive::shared_resource<int>{};
+
+    auto access_scope = x.access();
+    ASSERT_TRUE(access_scope);
+
+    std::async(std::launch::async, [&x] {
+        auto ec = std::error_code{};
+
+        EXPECT_FALSE(x.try_access_within(0s, ec));
+        EXPECT_EQ(std::make_error_code(std::errc::timed_out), ec);
+    }).get();
+}
+
+TYPED_TEST(SharedResourceClhQueue, ScopedAccessFailureOnTimeout)
+{
+    auto x = exclusive::shared_resource<int, TypeParam>{};
 
     auto end = std::promise<void>{};
     auto on_access = std::promise<void>{};
@@ -196,3 +342,510 @@ TEST(SharedResourceClhLock, ScopedAccessFailureOnTimeout)
 
     end.set_value();
 }
+
+// Given two shared resources,
+// When threads transfer between them, naming the resources in opposite orders,
+// Then all transfers complete without deadlock and the total is preserved.
+TYPED_TEST(SharedResourceAccessAll, TransferInOppositeOrders)
+{
+    auto a = exclusive::shared_resource<int, TypeParam>{};
+    auto b = exclusive::shared_resource<int, TypeParam>{};
+
+    constexpr auto n = 1'000;
+
+    auto t1 = std::thread{[&a, &b] {
+        for (auto i = 0; i != n; ++i) {
+            const auto access = exclusive::access_all(a, b);
+            auto [x, y] = *access;
+            --x;
+            ++y;
+        }
+    }};
+    auto t2 = std::thread{[&a, &b] {
+        for (auto i = 0; i != n; ++i) {
+            const auto access = exclusive::access_all(b, a);
+            auto [y, x] = *access;
+            x += 2;
+            y -= 2;
+        }
+    }};
+
+    t1.join();
+    t2.join();
+
+    const auto access = exclusive::access_all(a, b);
+    EXPECT_EQ(n, std::get<0>(*access));
+    EXPECT_EQ(-n, std::get<1>(*access));
+}
+
+// Given two shared resources where one is held by another thread,
+// When acquiring access to both within a timeout,
+// Then acquisition fails and the free resource is not left locked.
+TYPED_TEST(SharedResourceAccessAll, TimeoutReleasesPartialHold)
+{
+    auto a = exclusive::shared_resource<int, TypeParam>{};
+    auto b = exclusive::shared_resource<int, TypeParam>{};
+
+    auto end = std::promise<void>{};
+    auto on_access = std::promise<void>{};
+    auto has_access = on_access.get_future();
+
+    auto task = std::async(
+        std::launch::async,
+        [&b](auto on_access, auto stop_after) {
+            auto access_scope = b.access();
+
+            ASSERT_TRUE(access_scope);
+            on_access.set_value();
+
+            stop_after.get();
+        },
+        std::move(on_access),
+        end.get_future());
+
+    has_access.wait();
+
+    EXPECT_FALSE(exclusive::access_all_within(1ms, a, b));
+    EXPECT_FALSE(exclusive::access_all_within(1ms, b, a));
+    EXPECT_TRUE(a.access_within(0s));
+
+    end.set_value();
+    task.get();
+
+    EXPECT_TRUE(exclusive::access_all_within(1ms, a, b));
+}
+
+// Given two shared resources where the first is held by another thread,
+// When acquiring access to any of them,
+// Then access to the second is acquired and the first is not left queued.
+TYPED_TEST(SharedResourceAccessAny, AcquiresAvailableResource)
+{
+    auto a = exclusive::shared_resource<int, TypeParam>{};
+    auto b = exclusive::shared_resource<int, TypeParam>{};
+
+    auto end = std::promise<void>{};
+    auto on_access = std::promise<void>{};
+    auto has_access = on_access.get_future();
+
+    auto task = std::async(
+        std::launch::async,
+        [&a](auto on_access, auto stop_after) {
+            auto access_scope = a.access();
+
+            ASSERT_TRUE(access_scope);
+            on_access.set_value();
+
+            stop_after.get();
+        },
+        std::move(on_access),
+        end.get_future());
+
+    has_access.wait();
+
+    {
+        const auto access = exclusive::access_any(a, b);
+        ASSERT_TRUE(access);
+        EXPECT_EQ(1U, access.index());
+        EXPECT_FALSE(b.access_within(0s));
+    }
+
+    EXPECT_EQ(1U, a.queue_count());
+
+    end.set_value();
+    task.get();
+
+    EXPECT_TRUE(a.access_within(0s));
+}
+
+#if defined(__cpp_exceptions)
+// Given a shared resource without a free slot and an available resource,
+// When acquiring access to any of them,
+// Then the failure is thrown and the available resource is not left queued.
+TEST(SharedResourceClhLock, AccessAnyAbandonsQueuesWhenSlotsExceeded)
+{
+    using mutex = exclusive::clh_mutex<2, exclusive::failure::die>;
+
+    auto a = exclusive::shared_resource<int, mutex>{};
+    auto b = exclusive::shared_resource<int, mutex>{};
+
+    auto end = std::promise<void>{};
+    const auto hold = [&b](auto stop_after) {
+        auto access_scope = b.access();
+        stop_after.wait();
+    };
+
+    auto stop_after = end.get_future().share();
+    auto tasks = std::array{std::async(std::launch::async, hold, stop_after),
+                            std::async(std::launch::async, hold, stop_after),
+                            std::async(std::launch::async, hold, stop_after)};
+
+    // the holder recycles the initial tail node, leaving a node per waiter
+    while (b.queue_count() != 3U) {}
+
+    ASSERT_THROW(static_cast<void>(exclusive::access_any(a, b)), std::system_error);
+
+    EXPECT_EQ(0U, a.queue_count());
+    EXPECT_TRUE(a.access_within(0s));
+
+    end.set_value();
+    for (auto& fut : tasks) {
+        fut.get();
+    }
+}
+#endif
+
+// Given two shared resources both held by other threads,
+// When acquiring access to any of them within a timeout,
+// Then acquisition waits for a resource to be released.
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TYPED_TEST(SharedResourceAccessAny, WaitsForFirstRelease)
+{
+    auto a = exclusive::shared_resource<int, TypeParam>{};
+    auto b = exclusive::shared_resource<int, TypeParam>{};
+
+    const auto hold = [](auto* x, auto on_access, auto stop_after) {
+        auto access_scope = x->access();
+
+        ASSERT_TRUE(access_scope);
+        on_access.set_value();
+
+        stop_after.get();
+    };
+
+    auto end_a = std::promise<void>{};
+    auto on_access_a = std::promise<void>{};
+    auto has_access_a = on_access_a.get_future();
+    auto task_a = std::async(
+        std::launch::async, hold, &a, std::move(on_access_a), end_a.get_future());
+
+    auto end_b = std::promise<void>{};
+    auto on_access_b = std::promise<void>{};
+    auto has_access_b = on_access_b.get_future();
+    auto task_b = std::async(
+        std::launch::async, hold, &b, std::move(on_access_b), end_b.get_future());
+
+    has_access_a.wait();
+    has_access_b.wait();
+
+    EXPECT_FALSE(exclusive::access_any_within(1ms, a, b));
+
+    auto waiting = std::async(std::launch::async, [&a, &b] {
+        const auto access = exclusive::access_any_within(24h, a, b);
+        return access ? access.index() : 2U;
+    });
+
+    while ((a.queue_count() != 2U) || (b.queue_count() != 2U)) {}
+
+    end_b.set_value();
+    EXPECT_EQ(1U, waiting.get());
+
+    end_a.set_value();
+    task_a.get();
+    task_b.get();
+
+    EXPECT_TRUE(exclusive::access_all_within(0s, a, b));
+}
+
+// Given two shared resources held by other threads, where the first also has
+//   a queued waiter,
+// When acquiring access to any of them,
+// Then access to the second is acquired once it is released.
+TYPED_TEST(SharedResourceAccessAny, AcquiresReleasedResourceWhileOtherIsQueued)
+{
+    auto a = exclusive::shared_resource<int, TypeParam>{};
+    auto b = exclusive::shared_resource<int, TypeParam>{};
+
+    const auto hold = [](auto* x, auto stop_after) {
+        auto access_scope = x->access();
+
+        ASSERT_TRUE(access_scope);
+        stop_after.wait();
+    };
+
+    auto end_a = std::promise<void>{};
+    auto stop_after_a = end_a.get_future().share();
+    auto tasks_a = std::array{std::async(std::launch::async, hold, &a, stop_after_a),
+                              std::async(std::launch::async, hold, &a, stop_after_a)};
+
+    auto end_b = std::promise<void>{};
+    auto task_b = std::async(std::launch::async, hold, &b, end_b.get_future().share());
+
+    while ((a.queue_count() != 2U) || (b.queue_count() != 1U)) {}
+
+    auto waiting = std::async(std::launch::async, [&a, &b] {
+        const auto access = exclusive::access_any(a, b);
+        return access.index();
+    });
+
+    end_b.set_value();
+    task_b.get();
+    EXPECT_EQ(1U, waiting.get());
+
+    end_a.set_value();
+    for (auto& task : tasks_a) {
+        task.get();
+    }
+}
+
+// Given a thread holding access to a shared resource in a loop,
+// When another thread requests access,
+// Then the holder yields access to the waiting thread.
+TYPED_TEST(SharedResourceClhHandoff, YieldIfContendedHandsOffAccess)
+{
+    auto x = exclusive::shared_resource<int, TypeParam>{};
+
+    auto on_access = std::promise<void>{};
+    auto has_access = on_access.get_future();
+
+    auto task = std::async(
+        std::launch::async,
+        [&x](auto on_access) {
+            auto access_scope = x.access();
+            EXPECT_FALSE(access_scope.yield_if_contended());
+
+            on_access.set_value();
+
+            auto yields = 0;
+            while (*access_scope == 0) {
+                if (access_scope.yield_if_contended()) {
+                    ++yields;
+                }
+            }
+            return yields;
+        },
+        std::move(on_access));
+
+    has_access.wait();
+
+    ++*x.access();
+
+    EXPECT_EQ(1, task.get());
+}
+
+// Given a shared resource with a transferable mutex,
+// When access is acquired in one thread and moved to another,
+// Then the receiving thread releases access without relocking.
+TYPED_TEST(SharedResourceClhQueue, TransferAccessBetweenThreads)
+{
+    static_assert(exclusive::is_transferable_v<TypeParam>);
+    static_assert(!exclusive::is_transferable_v<std::timed_mutex>);
+
+    auto x = exclusive::shared_resource<int, TypeParam>{};
+
+    auto first = x.access_transferable();
+    ASSERT_TRUE(first);
+    ++*first;
+
+    auto second = std::move(first);
+    EXPECT_FALSE(first);  // NOLINT(bugprone-use-after-move,hicpp-invalid-access-moved)
+    ASSERT_TRUE(second);
+
+    EXPECT_FALSE(x.access_within(0s));
+
+    auto stage = std::async(
+        std::launch::async,
+        [](auto access) {
+            ++*access;
+            return *access;
+        },
+        std::move(second));
+
+    EXPECT_EQ(2, stage.get());
+    EXPECT_EQ(2, *x.access_transferable_within(0s));
+}
+
+// Given a shared resource with leases enabled,
+// When access is held for longer than the hold budget,
+// Then the overrun is reported when access is released.
+TEST(SharedResourceLease, OverrunReportedByHolder)
+{
+    auto x = exclusive::shared_resource<leased_counter, exclusive::array_mutex<2>>{};
+    x.set_overrun_handler(record_overrun);
+    overrun_reported = false;
+
+    {
+        const auto access = x.access_for(1ms, "holder");
+        ASSERT_TRUE(access);
+
+        const auto start = access.acquired_at();
+        while ((std::chrono::steady_clock::now() - start) <= 1ms) {}
+
+        EXPECT_EQ(0U, x.overrun_count());
+    }
+
+    EXPECT_EQ(1U, x.overrun_count());
+    EXPECT_TRUE(overrun_reported);
+    EXPECT_STREQ("holder", overrun_holder);
+
+    {
+        const auto access = x.access_for(24h);
+        ASSERT_TRUE(access);
+    }
+
+    EXPECT_EQ(1U, x.overrun_count());
+}
+
+// Given a leased shared resource held beyond its hold budget,
+// When another thread waits on the resource,
+// Then the waiting thread reports the overrun while access is still held.
+TYPED_TEST(SharedResourceClhLease, OverrunReportedByWaiter)
+{
+    auto x = exclusive::shared_resource<leased_counter, TypeParam>{};
+    x.set_overrun_handler(record_overrun);
+    overrun_reported = false;
+
+    auto on_access = std::promise<void>{};
+    auto has_access = on_access.get_future();
+
+    auto task = std::async(
+        std::launch::async,
+        [&x](auto on_access) {
+            const auto access = x.access_for(1ms, "stalled");
+            ASSERT_TRUE(access);
+            on_access.set_value();
+
+            // only release access after a waiter reports the overrun
+            while (!overrun_reported) {}
+        },
+        std::move(on_access));
+
+    has_access.wait();
+
+    EXPECT_TRUE(x.access());
+    task.get();
+
+    EXPECT_EQ(1U, x.overrun_count());
+    EXPECT_STREQ("stalled", overrun_holder);
+}
+
+// Given a leased shared resource held beyond its hold budget,
+// When another thread waits on it with access_all,
+// Then the waiting thread reports the overrun while access is still held.
+TYPED_TEST(SharedResourceClhLease, OverrunReportedByAccessAllWaiter)
+{
+    auto x = exclusive::shared_resource<leased_counter, TypeParam>{};
+    auto y = exclusive::shared_resource<leased_counter, TypeParam>{};
+    x.set_overrun_handler(record_overrun);
+    overrun_reported = false;
+
+    auto on_access = std::promise<void>{};
+    auto has_access = on_access.get_future();
+
+    auto task = std::async(
+        std::launch::async,
+        [&x](auto on_access) {
+            const auto access = x.access_for(1ms, "stalled");
+            ASSERT_TRUE(access);
+            on_access.set_value();
+
+            // only release access after a waiter reports the overrun
+            while (!overrun_reported) {}
+        },
+        std::move(on_access));
+
+    has_access.wait();
+
+    EXPECT_TRUE(exclusive::access_all_within(24h, x, y));
+    task.get();
+
+    EXPECT_EQ(1U, x.overrun_count());
+    EXPECT_STREQ("stalled", overrun_holder);
+}
+
+// Given leased shared resources, one held beyond its hold budget,
+// When another thread waits on them with access_any,
+// Then the waiting thread reports the overrun while access is still held.
+TYPED_TEST(SharedResourceClhLease, OverrunReportedByAccessAnyWaiter)
+{
+    auto x = exclusive::shared_resource<leased_counter, TypeParam>{};
+    auto y = exclusive::shared_resource<leased_counter, TypeParam>{};
+    y.set_overrun_handler(record_overrun);
+    overrun_reported = false;
+
+    auto on_access = std::promise<void>{};
+    auto has_access = on_access.get_future();
+
+    auto task = std::async(
+        std::launch::async,
+        [&x, &y](auto on_access) {
+            const auto first = x.access();
+            const auto second = y.access_for(1ms, "stalled");
+            ASSERT_TRUE(first);
+            ASSERT_TRUE(second);
+            on_access.set_value();
+
+            // only release access after a waiter reports the overrun
+            while (!overrun_reported) {}
+        },
+        std::move(on_access));
+
+    has_access.wait();
+
+    EXPECT_TRUE(exclusive::access_any(x, y));
+    task.get();
+
+    EXPECT_EQ(0U, x.overrun_count());
+    EXPECT_EQ(1U, y.overrun_count());
+    EXPECT_STREQ("stalled", overrun_holder);
+}
+
+// Given a shared_resource with an isolated layout,
+// When the resource is accessed,
+// Then the resource and mutex do not share cache lines.
+TEST(SharedResourceLayout, Isolated)
+{
+    constexpr auto pair = exclusive::hardware_prefetch_interference_size;
+
+    auto x = exclusive::shared_resource<isolated_counter, std::mutex>{};
+    static_assert(alignof(decltype(x)) == pair);
+    static_assert(sizeof(x) >= 2 * pair);
+
+    const auto* resource = &(*x.access());
+
+    EXPECT_EQ(0U, offset_of(resource, &x) % pair);
+    EXPECT_LE(offset_of(resource, &x) + pair, sizeof(x));
+}
+
+// Given a shared_resource with a colocated layout,
+// When the resource is accessed,
+// Then the resource shares a cache line with the mutex.
+TEST(SharedResourceLayout, Colocated)
+{
+    constexpr auto line = exclusive::hardware_destructive_interference_size;
+    static_assert(sizeof(std::mutex) + sizeof(colocated_counter) <= line);
+
+    auto x = exclusive::shared_resource<colocated_counter, std::mutex>{};
+    static_assert(alignof(decltype(x)) == line);
+
+    const auto* resource = &(*x.access());
+
+    EXPECT_GE(offset_of(resource, &x), sizeof(std::mutex));
+    EXPECT_LE(offset_of(resource, &x) + sizeof(colocated_counter), line);
+}
+
+// Given shared_resources with each layout,
+// When accessed from multiple threads,
+// Then access is synchronized.
+TEST(SharedResourceLayout, AccessFromMultipleThreads)
+{
+    auto x = exclusive::shared_resource<isolated_counter, std::mutex>{};
+    auto y = exclusive::shared_resource<colocated_counter, std::mutex>{};
+
+    const auto inc_n = [&x, &y](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) {
+            ++(*x.access()).value;
+            ++(*y.access()).value;
+        }
+    };
+
+    constexpr auto n = 1'000;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+
+    EXPECT_EQ(2 * n, (*x.access()).value);
+    EXPECT_EQ(2 * n, (*y.access()).value);
+}
@@ -0,0 +1,138 @@
+#include "exclusive/exclusive.hpp"
+#include "exclusive/test/access_task.hpp"
+#include "exclusive/test/fake_clock.hpp"
+#include "exclusive/ticket_mutex.hpp"
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+namespace {
+using namespace std::literals::chrono_literals;
+namespace test = exclusive::test;
+}  // namespace
+
+// Given a ticket_mutex,
+// When locking without contention,
+// Then the mutex behaves as a TimedMutex.
+TEST(TicketLock, Uncontended)
+{
+    auto mut = exclusive::ticket_mutex<>{};
+
+    EXPECT_TRUE(mut.try_lock());
+    EXPECT_FALSE(mut.try_lock());
+    mut.unlock();
+
+    EXPECT_TRUE(mut.try_lock_for(0s));
+    EXPECT_FALSE(mut.try_lock_for(0s));
+    mut.unlock();
+
+    mut.lock();
+    mut.unlock();
+}
+
+// Given a ticket_mutex held by another thread,
+// When waiting on the lock until a deadline,
+// Then locking fails after the deadline is reached and the abandoned ticket
+// is skipped.
+TEST(TicketLock, Timeout)
+{
+    auto mut = exclusive::ticket_mutex<>{};
+
+    auto task1 = test::AccessTask{mut};
+    task1.wait_for_access();
+
+    const auto deadline = test::fake_clock::now() + 10ms;
+    auto task2 = test::AccessTask{mut, deadline};
+
+    test::fake_clock::set_now(deadline);
+    EXPECT_FALSE(task2.get());
+
+    EXPECT_TRUE(task1.terminate());
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+// Given a ticket_mutex with an abandoned ticket ahead of a waiting thread,
+// When the lock is released,
+// Then the lock is granted to the waiting thread.
+TEST(TicketLock, AbandonnedTicketIsSkippedOver)
+{
+    auto mut = exclusive::ticket_mutex<>{};
+
+    auto task1 = test::AccessTask{mut};
+    task1.wait_for_access();
+
+    const auto deadline = test::fake_clock::now() + 10ms;
+    auto task2 = test::AccessTask{mut, deadline};
+    auto task3 = test::AccessTask{mut};
+
+    test::fake_clock::set_now(deadline);
+    EXPECT_FALSE(task2.get());
+
+    EXPECT_TRUE(task1.terminate());
+    task3.wait_for_access();
+    EXPECT_TRUE(task3.terminate());
+}
+
+// Given a ticket_mutex contended by threads with short deadlines,
+// When threads repeatedly abandon tickets,
+// Then the lock is never granted to more than one thread.
+TEST(TicketLock, ContendedTimeouts)
+{
+    auto mut = exclusive::ticket_mutex<1>{};
+    auto holders = std::atomic<int>{};
+    auto acquired = std::atomic<std::size_t>{};
+
+    const auto try_n = [&](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) {
+            if (mut.try_lock_for(10us)) {
+                EXPECT_EQ(1, ++holders);
+                ++acquired;
+                --holders;
+                mut.unlock();
+            }
+        }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{try_n, n};
+    auto t2 = std::thread{try_n, n};
+    auto t3 = std::thread{try_n, n};
+    auto t4 = std::thread{try_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    EXPECT_NE(0U, acquired.load());
+    EXPECT_TRUE(mut.try_lock());
+    mut.unlock();
+}
+
+TEST(SharedResourceTicketLock, AccessFromMultipleThreads)
+{
+    auto x = exclusive::shared_resource<int, exclusive::ticket_mutex<>>{};
+
+    const auto inc_n = [&x](std::size_t n) {
+        for (std::size_t i = 0U; i != n; ++i) { ++(*x.access()); }
+    };
+
+    constexpr auto n = 1'000U;
+
+    auto t1 = std::thread{inc_n, n};
+    auto t2 = std::thread{inc_n, n};
+    auto t3 = std::thread{inc_n, n};
+    auto t4 = std::thread{inc_n, n};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    EXPECT_EQ(4 * n, *x.access());
+}
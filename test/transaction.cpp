@@ -0,0 +1,181 @@
+#include "exclusive/mutex.hpp"
+#include "exclusive/transaction.hpp"
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <functional>
+#include <thread>
+
+namespace {
+
+struct account {
+    int balance;
+    int transfers;
+};
+
+}  // namespace
+
+// Given a versioned resource,
+// When a transaction modifies it without contention,
+// Then the modification is committed on the first attempt.
+TEST(Transaction, UncontendedCommit)
+{
+    auto x = exclusive::versioned_resource<account>{};
+
+    EXPECT_EQ(0, x.read().value.balance);
+    EXPECT_EQ(0U, x.read().version);
+
+    EXPECT_EQ(1U, exclusive::transact([](auto& a) { a.balance = 42; }, x));
+
+    EXPECT_EQ(42, x.read().value.balance);
+    EXPECT_EQ(2U, x.read().version);
+}
+
+// Given two versioned resources,
+// When a transaction only reads them,
+// Then no version is changed.
+TEST(Transaction, ReadOnlyDoesNotWrite)
+{
+    auto x = exclusive::versioned_resource<int>{};
+    auto y = exclusive::versioned_resource<int>{};
+
+    exclusive::transact([](auto& a) { a = 1; }, x);
+
+    auto sum = 0;
+    EXPECT_EQ(1U, exclusive::transact([&sum](auto a, auto b) { sum = a + b; }, x, y));
+
+    EXPECT_EQ(1, sum);
+    EXPECT_EQ(2U, x.read().version);
+    EXPECT_EQ(0U, y.read().version);
+}
+
+// Given two versioned resources,
+// When one is written after a read-only transaction takes its snapshots,
+// Then the transaction is retried with consistent snapshots.
+TEST(Transaction, ReadOnlyValidatesSnapshots)
+{
+    auto x = exclusive::versioned_resource<int>{};
+    auto y = exclusive::versioned_resource<int>{};
+
+    auto calls = 0;
+    auto sum = 0;
+
+    const auto attempts = exclusive::transact(
+        [&calls, &sum, &y](auto a, auto b) {
+            if (calls++ == 0) {
+                exclusive::transact([](auto& c) { c = 1; }, y);
+            }
+            sum = a + b;
+        },
+        x,
+        y);
+
+    EXPECT_EQ(2U, attempts);
+    EXPECT_EQ(1, sum);
+    EXPECT_EQ(0U, x.read().version);
+}
+
+// Given three versioned resources,
+// When threads concurrently transfer between overlapping pairs,
+// Then the total is preserved and every transfer is committed exactly once.
+TEST(Transaction, ConcurrentTransfersPreserveTotal)
+{
+    using resource = exclusive::versioned_resource<account, exclusive::clh_mutex<4>>;
+
+    auto a = resource{};
+    auto b = resource{};
+    auto c = resource{};
+
+    constexpr auto n = 1'000;
+
+    const auto transfer_n = [](resource& from, resource& to) {
+        for (auto i = 0; i != n; ++i) {
+            exclusive::transact(
+                [](auto& src, auto& dst) {
+                    --src.balance;
+                    ++dst.balance;
+                    ++src.transfers;
+                    ++dst.transfers;
+                },
+                from,
+                to);
+        }
+    };
+
+    auto t1 = std::thread{transfer_n, std::ref(a), std::ref(b)};
+    auto t2 = std::thread{transfer_n, std::ref(b), std::ref(c)};
+    auto t3 = std::thread{transfer_n, std::ref(c), std::ref(a)};
+    auto t4 = std::thread{transfer_n, std::ref(a), std::ref(c)};
+
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    const auto sa = a.read().value;
+    const auto sb = b.read().value;
+    const auto sc = c.read().value;
+
+    EXPECT_EQ(0, sa.balance + sb.balance + sc.balance);
+    EXPECT_EQ(8 * n, sa.transfers + sb.transfers + sc.transfers);
+    EXPECT_EQ(-n, sa.balance);
+    EXPECT_EQ(0, sb.balance);
+    EXPECT_EQ(n, sc.balance);
+}
+
+// Given two versioned resources, where at least one must be set,
+// When threads concurrently clear their own resource if the other is set,
+// Then both are never cleared (no write skew).
+TEST(Transaction, ConcurrentReadWriteIsSerializable)
+{
+    using resource = exclusive::versioned_resource<int, exclusive::clh_mutex<4>>;
+
+    auto x = resource{};
+    auto y = resource{};
+
+    exclusive::transact(
+        [](auto& a, auto& b) {
+            a = 1;
+            b = 1;
+        },
+        x,
+        y);
+
+    constexpr auto n = 1'000;
+
+    auto violations = std::atomic_int{};
+
+    const auto toggle_n = [&violations](resource& own, resource& other) {
+        for (auto i = 0; i != n; ++i) {
+            exclusive::transact(
+                [](auto& mine, auto theirs) {
+                    if ((mine + theirs) == 2) {
+                        mine = 0;
+                    }
+                },
+                own,
+                other);
+
+            // only the committed attempt observes a consistent state
+            auto cleared = false;
+            exclusive::transact(
+                [&cleared](auto mine, auto theirs) { cleared = ((mine + theirs) == 0); },
+                own,
+                other);
+
+            if (cleared) {
+                ++violations;
+            }
+
+            exclusive::transact([](auto& mine) { mine = 1; }, own);
+        }
+    };
+
+    auto t1 = std::thread{toggle_n, std::ref(x), std::ref(y)};
+    auto t2 = std::thread{toggle_n, std::ref(y), std::ref(x)};
+
+    t1.join();
+    t2.join();
+
+    EXPECT_EQ(0, violations);
+}